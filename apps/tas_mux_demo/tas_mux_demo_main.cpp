@@ -0,0 +1,152 @@
+/*
+ *  Copyright (c) 2024 Infineon Technologies AG.
+ *
+ *  This file is part of TAS Client, an API for device access for Infineon's 
+ *  automotive MCUs. 
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *  **************************************************************************************************************** */
+
+//********************************************************************************************************************
+//------------------------------------------------------Includes------------------------------------------------------
+//********************************************************************************************************************
+#include "tas_client_rw.h"
+#include "tas_pkt_mailbox_mux.h"
+#include "tas_device_family.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+//********************************************************************************************************************
+//----------------------------------------------------- Main ---------------------------------------------------------
+//********************************************************************************************************************
+int main(int argc, char** argv)
+{
+    printf("TAS multiplexed connection demo\n");
+
+    // Number of clients can be passed as the first argument
+    uint32_t numClients = (argc > 1) ? (uint32_t)strtoul(argv[1], nullptr, 0) : 4;
+    if (numClients == 0)
+        numClients = 1;
+
+    // One server connection which is shared by all clients
+    CTasPktMailboxMux mux("DemoMux");
+    tas_return_et ret = mux.server_connect("localhost");
+    if (ret != TAS_ERR_NONE)
+    {
+        printf("Failed to connect to the server, %s\n", mux.get_error_info());
+        return -1;  // Fatal
+    }
+
+    const tas_server_info_st* serverInfo = mux.get_server_info();
+    printf("%s V%d.%d (%s)\n", serverInfo->server_name, serverInfo->v_major, serverInfo->v_minor, serverInfo->date);
+    if (mux.get_con_id_routing())
+    {
+        printf("Sessions are routed by con_id, each client has its own server session\n");
+    }
+    else
+    {
+        // The server keeps one session per connection
+        printf("Server does not support con_id sessions, only one client can use the connection\n");
+        numClients = 1;
+    }
+
+    // Each client needs a session of the connection which outlives the client
+    std::vector<std::unique_ptr<CTasPktMailboxMuxSession>> sessions;
+    for (uint32_t i = 0; i < numClients; i++)
+    {
+        sessions.push_back(mux.open_session());
+        if (!sessions.back())
+        {
+            printf("No session for client %d, %s\n", i, mux.get_error_info());
+            return -1;  // Fatal
+        }
+    }
+
+    // Get the target with the first client
+    const tas_target_info_st* targets;
+    uint32_t numTargets;
+    std::string identifier;
+    {
+        CTasClientRw clientRw(sessions[0].get(), "DemoMuxClient0");
+        if ((clientRw.server_connect("localhost") != TAS_ERR_NONE)
+            || (clientRw.get_targets(&targets, &numTargets) != TAS_ERR_NONE))
+        {
+            printf("Failed to get the list of targets, %s\n", clientRw.get_error_info());
+            return -1;  // Fatal
+        }
+        if (numTargets == 0)
+        {
+            printf("No target connected to the server\n");
+            return -1;  // Fatal
+        }
+        identifier = targets[0].identifier;
+    }
+    printf("Target: %s\n\n", identifier.c_str());
+
+    // Each client accesses its own word in parallel
+    const uint32_t baseAddr = 0x70000000;
+    std::atomic<uint32_t> numOk(0);
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < numClients; i++)
+    {
+        threads.emplace_back([&, i]
+        {
+            std::string clientName = "DemoMuxClient" + std::to_string(i);
+            CTasClientRw clientRw(sessions[i].get(), clientName.c_str());
+            if ((clientRw.server_connect("localhost") != TAS_ERR_NONE)
+                || (clientRw.session_start(identifier.c_str(), "DemoMuxSession") != TAS_ERR_NONE))
+            {
+                printf("Client %d: %s\n", i, clientRw.get_error_info());
+                return;
+            }
+            if (!tas_device_family_is_aurix(clientRw.get_con_info()->device_type))
+            {
+                printf("Client %d: The address 0x%8.8X is for AURIX devices\n", i, baseAddr);
+                return;
+            }
+
+            const uint32_t addr = baseAddr + i * 4;
+            for (uint32_t k = 0; k < 100; k++)
+            {
+                uint32_t value = (i << 24) | k;
+                uint32_t rdData;
+                if ((clientRw.write32(addr, value) != TAS_ERR_NONE) || (clientRw.read32(addr, &rdData) != TAS_ERR_NONE))
+                {
+                    printf("Client %d: %s\n", i, clientRw.get_error_info());
+                    return;
+                }
+                if (rdData != value)
+                {
+                    printf("Client %d: Read back 0x%08X instead of 0x%08X at 0x%08X\n", i, rdData, value, addr);
+                    return;
+                }
+            }
+            printf("Client %d: 100 write/read cycles at 0x%08X done\n", i, addr);
+            numOk++;
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+
+    // The sessions are closed after their clients
+    sessions.clear();
+
+    printf("\n%d of %d clients completed\n", (uint32_t)numOk, numClients);
+    return (numOk == numClients) ? 0 : -1;
+}
@@ -0,0 +1,112 @@
+/*
+ *  Copyright (c) 2024 Infineon Technologies AG.
+ *
+ *  This file is part of TAS Client, an API for device access for Infineon's
+ *  automotive MCUs.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *  **************************************************************************************************************** */
+
+//********************************************************************************************************************
+//------------------------------------------------------Includes------------------------------------------------------
+//********************************************************************************************************************
+#include "tas_pkt_handler_rw.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <chrono>
+#include <vector>
+
+//********************************************************************************************************************
+//----------------------------------------------------- Main ---------------------------------------------------------
+//********************************************************************************************************************
+
+//! \brief Measure the time of one header validation kernel in ns per header
+//! \param kernel header validation kernel
+//! \param rsp response words
+//! \param wi word indices of the headers
+//! \param hdr expected header words
+//! \param num_iter number of iterations
+//! \returns the time per header in ns
+static double benchKernel(CTasPktHandlerRw::tas_rsp_hdr_kernel_et kernel, const std::vector<uint32_t>& rsp,
+	const std::vector<uint32_t>& wi, const std::vector<uint32_t>& hdr, uint32_t num_iter)
+{
+	const uint32_t numHdr = (uint32_t)hdr.size();
+	uint32_t numMatch = 0;
+	auto t0 = std::chrono::steady_clock::now();
+	for (uint32_t i = 0; i < num_iter; i++) {
+		if (CTasPktHandlerRw::rsp_hdr_match(kernel, rsp.data(), wi.data(), hdr.data(), numHdr))
+			numMatch++;
+	}
+	auto t1 = std::chrono::steady_clock::now();
+	if (numMatch != num_iter) {
+		printf("ERROR: Header mismatch\n");
+		exit(-1);
+	}
+	double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+	return ns / ((double)num_iter * numHdr);
+}
+
+int main(int argc, char** argv)
+{
+	printf("TAS response header validation benchmark\n");
+
+	// Number of iterations can be passed as the first argument
+	uint32_t numIter = (argc > 1) ? (uint32_t)strtoul(argv[1], nullptr, 0) : 100000;
+	if (numIter == 0)
+		numIter = 1;
+
+	const bool avx2 = CTasPktHandlerRw::rsp_hdr_kernel_supported(CTasPktHandlerRw::RSP_HDR_KERNEL_AVX2);
+	if (!avx2)
+		printf("AVX2 kernel is not supported on this CPU\n");
+
+	printf("\n%8s %12s %12s %8s\n", "num_hdr", "scalar ns", "avx2 ns", "speedup");
+
+	// Response layout of a batch of 32 bit reads: one PL0 header word followed by one data word.
+	// The PL1 and PL0 start/end words of a packet are in front.
+	const uint32_t numHdrList[] = { 8, 32, 128, 256, 1024 };
+	for (uint32_t numHdr : numHdrList) {
+		std::vector<uint32_t> rsp(4 + 2 * numHdr);
+		std::vector<uint32_t> wi(numHdr);
+		std::vector<uint32_t> hdr(numHdr);
+		for (uint32_t i = 0; i < numHdr; i++) {
+			wi[i] = 4 + 2 * i;
+			hdr[i] = 0x08000000 | (i << 8) | 0x81;
+			rsp[wi[i]] = hdr[i];
+			rsp[wi[i] + 1] = 0xA5A5A5A5 ^ i;  // Data
+		}
+
+		// Both kernels have to detect a mismatch in the last header
+		rsp[wi[numHdr - 1]] ^= 1;
+		bool mismatchOk = !CTasPktHandlerRw::rsp_hdr_match(CTasPktHandlerRw::RSP_HDR_KERNEL_SCALAR, rsp.data(), wi.data(), hdr.data(), numHdr);
+		if (avx2)
+			mismatchOk &= !CTasPktHandlerRw::rsp_hdr_match(CTasPktHandlerRw::RSP_HDR_KERNEL_AVX2, rsp.data(), wi.data(), hdr.data(), numHdr);
+		rsp[wi[numHdr - 1]] ^= 1;
+		if (!mismatchOk) {
+			printf("ERROR: Header mismatch was not detected\n");
+			return -1;
+		}
+
+		double nsScalar = benchKernel(CTasPktHandlerRw::RSP_HDR_KERNEL_SCALAR, rsp, wi, hdr, numIter);
+		if (avx2) {
+			double nsAvx2 = benchKernel(CTasPktHandlerRw::RSP_HDR_KERNEL_AVX2, rsp, wi, hdr, numIter);
+			printf("%8u %12.3f %12.3f %8.2f\n", numHdr, nsScalar, nsAvx2, nsScalar / nsAvx2);
+		}
+		else {
+			printf("%8u %12.3f %12s %8s\n", numHdr, nsScalar, "-", "-");
+		}
+	}
+
+	return 0;
+}
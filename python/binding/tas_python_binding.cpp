@@ -67,6 +67,7 @@ PYBIND11_MODULE(PyTAS, m) {
         .def_readwrite("supp_protoc_ver", &tas_server_info_st::supp_protoc_ver)
         .def_readwrite("supp_chl_target", &tas_server_info_st::supp_chl_target)
         .def_readwrite("supp_trc_type", &tas_server_info_st::supp_trc_type)
+        .def_readwrite("supp_feat", &tas_server_info_st::supp_feat)
         .def_readwrite("start_time_us", &tas_server_info_st::start_time_us);
 
     py::class_<TasRwTransaction>(m, "TasRwTransaction")
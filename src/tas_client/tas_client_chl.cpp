@@ -25,6 +25,7 @@
 #include <cassert>
 #include <cstdio>
 #include <memory>
+#include <utility>
 #include <array>
 
 CTasClientChl::CTasClientChl(const char* client_name)
@@ -38,6 +39,16 @@ CTasClientChl::CTasClientChl(const char* client_name)
 	mChlNum = TAS_CHL_NUM_MAX;
 }
 
+CTasClientChl::CTasClientChl(CTasPktMailboxIf* mb_if, const char* client_name)
+	: CTasClientServerCon(client_name, &mEi, mb_if)
+	, mMbIfChl(mb_if), mTphChl(&mEi)
+{
+	mMbIfChl->config(TAS_DEFAULT_TIMEOUT_MS, TAS_PL1_CHL_MAX_MSG_SIZE);
+
+	mChlCht = TAS_CHT_NONE;
+	mChlNum = TAS_CHL_NUM_MAX;
+}
+
 CTasClientChl::CTasClientChl(CTasPktMailboxIf* mb_if)
 	: CTasClientServerCon("", &mEi, mb_if)
 	, mMbIfChl(mb_if), mTphChl(&mEi)
@@ -48,6 +59,33 @@ CTasClientChl::CTasClientChl(CTasPktMailboxIf* mb_if)
 	mChlNum = TAS_CHL_NUM_MAX;
 }
 
+CTasClientChl::CTasClientChl(CTasClientChl&& other) noexcept
+	: CTasClientServerCon(static_cast<CTasClientServerCon&&>(other), &mEi)
+	, mEi(other.mEi), mMbIfChl(other.mMbIfChl), mTphChl(std::move(other.mTphChl))
+{
+	mTphChl.set_error_info(&mEi);
+
+	mChlCht = other.mChlCht;
+	mChlNum = other.mChlNum;
+	other.mChlCht = TAS_CHT_NONE;
+}
+
+CTasClientChl& CTasClientChl::operator= (CTasClientChl&& other) noexcept
+{
+	if (this != &other) {
+		CTasClientServerCon::operator=(static_cast<CTasClientServerCon&&>(other));
+		mEi = other.mEi;
+		mMbIfChl = other.mMbIfChl;
+		mTphChl = std::move(other.mTphChl);
+		mTphChl.set_error_info(&mEi);
+
+		mChlCht = other.mChlCht;
+		mChlNum = other.mChlNum;
+		other.mChlCht = TAS_CHT_NONE;
+	}
+	return *this;
+}
+
 tas_return_et CTasClientChl::session_start(const char* identifier, const char* session_name, const char* session_pw, 
 	                                       tas_chl_target_et chl_target, uint64_t chl_param)
 {
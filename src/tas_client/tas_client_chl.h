@@ -38,6 +38,25 @@ public:
 	//! \param client_name Mandatory client name as a c-string
 	explicit CTasClientChl(const char* client_name);
 
+	//! \brief Channel object constructor for a connection which is shared with other clients
+	//! \details server_connect() does not open a socket but checks that mb_if is connected, e.g. to the server
+	//! of a \ref CTasPktMailboxMux.
+	//! \param mb_if Mailbox of the client, e.g. from \ref CTasPktMailboxMux::open_session(). Must outlive the client.
+	//! \param client_name Mandatory client name as a c-string
+	CTasClientChl(CTasPktMailboxIf* mb_if, const char* client_name);
+
+	//! \brief Channel object move constructor
+	//! \details The server connection, the session and a subscribed channel are taken over.
+	//! The moved-from object can only be destroyed or assigned to.
+	//! \param other channel object which is moved from
+	CTasClientChl(CTasClientChl&& other) noexcept;
+
+	//! \brief Channel object move-assignment operator
+	//! \details The own server connection is closed before the one of other is taken over.
+	//! \param other channel object which is moved from
+	//! \returns reference to this object
+	CTasClientChl& operator= (CTasClientChl&& other) noexcept;
+
 	//! \brief Start a connection session
 	//! \details A session can only be started when a channel description is available in the TasServer.
 	//! The channel description is read from a device by the first ClientChl.session_start() call.
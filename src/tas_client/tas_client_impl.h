@@ -27,6 +27,7 @@
 // Standard includes
 #include <cassert>
 #include <cstdio>
+#include <cinttypes>
 
 #ifdef _DEBUG
 enum { TAS_DEFAULT_TIMEOUT_MS = -1 }; 		//!< \brief No timeout
@@ -34,10 +35,28 @@ enum { TAS_DEFAULT_TIMEOUT_MS = -1 }; 		//!< \brief No timeout
 enum { TAS_DEFAULT_TIMEOUT_MS = 20000 }; 	//!< \brief 20s
 #endif
 
+//! \brief Structured errors which are recorded without formatting the error info c-string
+enum tas_error_info_pending_et : uint8_t {
+	TAS_EI_PENDING_NONE      = 0,	//!< \brief The c-string is up to date
+	TAS_EI_PENDING_PL0       = 1,	//!< \brief PL0 error of a read or write transaction
+	TAS_EI_PENDING_ADD_TRANS = 2,	//!< \brief Transaction list could not be added to a request
+};
+
 //! \brief TAS error information including c-string and an error code.
+//! \details Errors on the hot path are recorded as structured fields only. The c-string is rendered
+//! on demand by \ref tas_get_error_info().
 struct tas_error_info_st {
 	char info[TAS_INFO_STR_LEN];	//!< \brief c-string describing the error
 	tas_return_et tas_err;			//!< \brief Corresponding error code
+
+	tas_error_info_pending_et pending = TAS_EI_PENDING_NONE;	//!< \brief Structured error which is not yet rendered to info
+	uint8_t  pl_err;		//!< \brief PL0 error code of \ref TAS_EI_PENDING_PL0
+	uint8_t  trans_type;	//!< \brief Transaction type \ref TAS_RW_TT_RD or \ref TAS_RW_TT_WR
+	uint8_t  addr_map;		//!< \brief Address map of the transaction
+	uint16_t acc_mode;		//!< \brief Access mode of the transaction
+	uint32_t num_bytes;		//!< \brief Number of bytes of the transaction
+	uint32_t num_trans;		//!< \brief Number of transactions of \ref TAS_EI_PENDING_ADD_TRANS
+	uint64_t addr;			//!< \brief Address of the failed transaction
 };
 
 //! \brief Clean up error information. 
@@ -47,9 +66,68 @@ inline tas_return_et tas_clear_error_info(tas_error_info_st* ei)
 {
 	ei->info[0] = 0;
 	ei->tas_err = TAS_ERR_NONE;
+	ei->pending = TAS_EI_PENDING_NONE;
 	return TAS_ERR_NONE;
 }
 
+//! \brief Get the error info c-string. A pending structured error is rendered first.
+//! \details A pending error is only rendered if the c-string was not written directly afterwards.
+//! \param ei Pointer to an error information
+//! \returns pointer to the c-string describing the error
+inline const char* tas_get_error_info(tas_error_info_st* ei)
+{
+	if ((ei->pending == TAS_EI_PENDING_NONE) || (ei->info[0] != 0)) {
+		ei->pending = TAS_EI_PENDING_NONE;
+		return ei->info;
+	}
+
+	if (ei->pending == TAS_EI_PENDING_ADD_TRANS) {
+		char transStr[TAS_INFO_STR_LEN / 2];
+		const char* typeStr = (ei->trans_type == TAS_RW_TT_RD) ? "RD" : "WR";
+		snprintf(transStr, sizeof(transStr), "%s addr=0x%" PRIX64 ", num_bytes=%" PRIu32 ", acc_mode=0x%4.4" PRIX16 ", addr_map=%" PRIu8,
+			typeStr, ei->addr, ei->num_bytes, ei->acc_mode, ei->addr_map);
+		if (ei->num_trans == 1)
+			snprintf(ei->info, TAS_INFO_STR_LEN, "ERROR: Failed to add %s", transStr);
+		else
+			snprintf(ei->info, TAS_INFO_STR_LEN, "ERROR: Failed to add %" PRIu32 " trans (first %s)", ei->num_trans, transStr);
+	}
+	else {
+		assert(ei->pending == TAS_EI_PENDING_PL0);
+		const char* typeStr = (ei->trans_type == TAS_RW_TT_RD) ? "Read" : "Write";
+
+		char addrMapStr[32];
+		addrMapStr[0] = 0;
+		if (ei->addr_map > 0)
+			snprintf(addrMapStr, sizeof(addrMapStr), "in addr_map %d ", ei->addr_map);
+
+		switch (ei->pl_err) {
+		case TAS_PL0_ERR_DATA:
+			snprintf(ei->info, TAS_INFO_STR_LEN, "ERROR: %s of addr %" PRIX64 " %sfailed", typeStr, ei->addr, addrMapStr);
+			break;
+		case TAS_PL0_ERR_DEV_LOCKED:
+			snprintf(ei->info, TAS_INFO_STR_LEN, "ERROR: Device is locked");
+			break;
+		case TAS_PL0_ERR_DEV_ACCESS:
+			snprintf(ei->info, TAS_INFO_STR_LEN, "ERROR: Device access failed");
+			break;
+		case TAS_PL0_ERR_ACC_MODE:
+			snprintf(ei->info, TAS_INFO_STR_LEN, "ERROR: Set acc_mode not supported for %s of addr %" PRIX64 " %s", typeStr, ei->addr, addrMapStr);
+			break;
+		case TAS_PL0_ERR_ADDR_MAP:
+			snprintf(ei->info, TAS_INFO_STR_LEN, "ERROR: addr_map %d not supported", ei->addr_map);
+			break;
+		case TAS_PL0_ERR_ADDR_BLOCKED:
+			snprintf(ei->info, TAS_INFO_STR_LEN, "ERROR: %s of addr %" PRIX64 " %swas blocked", typeStr, ei->addr, addrMapStr);
+			break;
+		default:
+			snprintf(ei->info, TAS_INFO_STR_LEN, "ERROR: %s of addr %" PRIX64 " %sreturned code 0x%2.2X", typeStr, ei->addr, addrMapStr, ei->pl_err);
+			break;
+		}
+	}
+	ei->pending = TAS_EI_PENDING_NONE;
+	return ei->info;
+}
+
 //! \brief Forces the caller to handel server connection error
 //! \param ei Pointer to an error information
 //! \returns \ref TAS_ERR_SERVER_CON
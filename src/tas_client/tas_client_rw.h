@@ -28,6 +28,7 @@
 
 // Standard includes
 #include <cassert>
+#include <array>
 
 //! \brief This class facilitates read/write access to a target.
 class CTasClientRw final : public CTasClientRwBase, public CTasClientServerCon
@@ -45,11 +46,41 @@ public:
 
 		assert(mTphRw == nullptr);
 		if (ret == TAS_ERR_NONE) {
-			mTphRw = new CTasPktHandlerRw(&mEi, get_con_info());
+			mInitSessionBuffers(get_con_info());
 		}
 		return ret;
 	}
 
+	//! \brief Connect to a server, start a session and connect to the device in two round trips
+	//! \details Same as \ref server_connect(), \ref session_start(), \ref device_connect() and \ref target_ping()
+	//! but the requests are sent back to back without waiting for the responses in between.
+	//! Use the separate calls if the server needs to be unlocked with \ref server_unlock() before the session start.
+	//! \param ip_addr Hostname of a TAS server, can be an IP address or a domain based hostname
+	//! \param identifier Unique access HW name or IP address of device as a c-string
+	//! \param session_name Unique session name as a c-string
+	//! \param session_pw Session password, specify to block other clients joining this session
+	//! \param dco Connection option, _RESET, _RESET_AND_HALT, _UNLOCK, default hot attach
+	//! \param port_num Server's port number, default: \ref TAS_PORT_NUM_SERVER_DEFAULT
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et open_session(const char* ip_addr, const char* identifier, const char* session_name = "", const char* session_pw = "",
+							   tas_clnt_dco_et dco = TAS_CLNT_DCO_HOT_ATTACH, uint16_t port_num = TAS_PORT_NUM_SERVER_DEFAULT)
+	{
+		std::array<uint32_t, TAS_MAX_PKT_SIZE_1KB / 4> pingRsp;
+		tas_return_et ret = mOpenSession(TAS_CLIENT_TYPE_RW, ip_addr, port_num, identifier, session_name, session_pw, dco, pingRsp.data());
+		if (!mSessionStarted)
+			return ret;
+
+		assert(mTphRw == nullptr);
+		mInitSessionBuffers(get_con_info());
+		if (ret != TAS_ERR_NONE)
+			return ret;  // Device connect failed
+
+		if (mTphRw->set_pkt_rsp_ping(TAS_PL1_CMD_PING, TAS_CLIENT_TYPE_RW, pingRsp.data()))
+			return mEi.tas_err;
+		mDeviceResetCount = mTphRw->get_device_reset_count();
+		return ret;
+	}
+
 	//! \brief Performs a check if device reset has occurred.
 	//! \returns \c true if reset occurred, otherwise \c false
 	bool device_reset_occurred() override
@@ -86,22 +117,70 @@ public:
 
 	//! \brief Read/Write client object constructor
 	//! \param client_name Mandatory client name as a c-string
-	explicit CTasClientRw(const char* client_name)
-		: CTasClientRwBase(CTasPktHandlerRw::PKT_BUF_SIZE_DEFAULT)
+	//! \param arena Optional caller-supplied memory of get_arena_size() bytes, 8 byte aligned. If nullptr, the memory
+	//! is allocated at session start and sized for the connection, see \ref rw_set_mem_budget().
+	explicit CTasClientRw(const char* client_name, void* arena = nullptr)
+		: CTasClientRwBase(CTasPktHandlerRw::PKT_BUF_SIZE_DEFAULT, arena)
 		, CTasClientServerCon(client_name, &mEi)
 	{
 		mMbIfRw = mMbSocket;
 		mMbIfRw->config(rw_get_timeout(), CTasPktHandlerRw::PKT_BUF_SIZE_DEFAULT);
 	};
 
+	//! \brief Read/Write client object constructor for a connection which is shared with other clients
+	//! \details server_connect() does not open a socket but checks that mb_if is connected, e.g. to the server
+	//! of a \ref CTasPktMailboxMux. All other functions are used as usual.
+	//! \param mb_if Mailbox of the client, e.g. from \ref CTasPktMailboxMux::open_session(). Must outlive the client.
+	//! \param client_name Mandatory client name as a c-string
+	//! \param arena Optional caller-supplied memory of get_arena_size() bytes, 8 byte aligned
+	CTasClientRw(CTasPktMailboxIf* mb_if, const char* client_name, void* arena = nullptr)
+		: CTasClientRwBase(CTasPktHandlerRw::PKT_BUF_SIZE_DEFAULT, arena)
+		, CTasClientServerCon(client_name, &mEi, mb_if)
+	{
+		mMbIfRw = mb_if;
+		mMbIfRw->config(rw_get_timeout(), CTasPktHandlerRw::PKT_BUF_SIZE_DEFAULT);
+	};
+
+	//! \brief Read/Write client move constructor
+	//! \details The server connection, the session and the buffers are taken over. Allows keeping clients in
+	//! containers and handing over connected clients, see \ref CTasClientRwPool.
+	//! The moved-from object can only be destroyed or assigned to.
+	//! \param other client which is moved from
+	CTasClientRw(CTasClientRw&& other) noexcept
+		: CTasClientRwBase(static_cast<CTasClientRwBase&&>(other))
+		, CTasClientServerCon(static_cast<CTasClientServerCon&&>(other), &mEi)
+	{}
+
+	//! \brief Read/Write client move-assignment operator
+	//! \details The own server connection and buffers are released before those of other are taken over.
+	//! \param other client which is moved from
+	//! \returns reference to this client
+	CTasClientRw& operator= (CTasClientRw&& other) noexcept
+	{
+		CTasClientRwBase::operator=(static_cast<CTasClientRwBase&&>(other));
+		CTasClientServerCon::operator=(static_cast<CTasClientServerCon&&>(other));
+		return *this;
+	}
+
+	using CTasClientRwBase::get_arena_size;
+
+	//! \brief Get the size of the memory arena for a client which is created with a client name
+	//! \returns the arena size in bytes, a multiple of 8
+	static size_t get_arena_size()
+	{
+		return get_arena_size(CTasPktHandlerRw::PKT_BUF_SIZE_DEFAULT, CTasPktHandlerRw::PKT_BUF_SIZE_DEFAULT,
+							  CTasPktHandlerRw::MAX_NUM_RW_DEFAULT);
+	}
+
 	//! \brief Read/Write client object constructor
 	//! \details !!Only needed for testing purposes. Not for regular TAS clients!!
 	//! \param mb_if Mailbox interface
 	//! \param max_rq_size Defines maximum size of request packets
 	//! \param max_rsp_size Defines maximum size of response packets
 	//! \param max_num_rw Defines maximum number of read/write transactions
-	CTasClientRw(CTasPktMailboxIf* mb_if, uint32_t max_rq_size, uint32_t max_rsp_size, uint32_t max_num_rw)
-		: CTasClientRwBase(mb_if, max_rq_size, max_rsp_size, max_num_rw)
+	//! \param arena Optional caller-supplied memory of get_arena_size(max_rq_size, max_rsp_size, max_num_rw) bytes
+	CTasClientRw(CTasPktMailboxIf* mb_if, uint32_t max_rq_size, uint32_t max_rsp_size, uint32_t max_num_rw, void* arena = nullptr)
+		: CTasClientRwBase(mb_if, max_rq_size, max_rsp_size, max_num_rw, arena)
 		, CTasClientServerCon("TestOnly", &mEi)
 	{
 		mMbIf = mb_if;
@@ -19,28 +19,189 @@
 // TAS includes
 #include "tas_client_rw_base.h"
 #include "tas_utils.h"
+#include "tas_rw_span_planner.h"
 
 // Standard includes
 #include <cassert>
 #include <cstdio>
+#include <cstring>
 #include <cinttypes>
 #include <memory>
 #include <array>
+#include <algorithm>
+#include <numeric>
+#include <utility>
 
-CTasClientRwBase::CTasClientRwBase(uint32_t max_rsp_size)
-	: mRspBuf(max_rsp_size / 4) {}
+CTasClientRwBase::CTasClientRwBase(uint32_t max_rsp_size, void* arena)
+	: mMaxRspSizeDefault(max_rsp_size)
+{
+	if (arena) {  // Otherwise allocated at session start
+		mInitArena(CTasPktHandlerRw::PKT_BUF_SIZE_DEFAULT, max_rsp_size, CTasPktHandlerRw::MAX_NUM_RW_DEFAULT, arena);
+		mTphMaxRspSize = max_rsp_size;
+	}
+}
 
 CTasClientRwBase::~CTasClientRwBase()
+{
+	mReleaseBuffers();
+}
+
+CTasClientRwBase::CTasClientRwBase(CTasClientRwBase&& other) noexcept
+	: mMaxRspSizeDefault(other.mMaxRspSizeDefault)
+{
+	mMoveFrom(other);
+}
+
+CTasClientRwBase& CTasClientRwBase::operator= (CTasClientRwBase&& other) noexcept
+{
+	if (this != &other) {
+		mReleaseBuffers();
+		mMoveFrom(other);
+	}
+	return *this;
+}
+
+void CTasClientRwBase::mReleaseBuffers()
 {
 	delete mTphRw;
+	delete mTphRwPipe;
+	delete mTphRwPlan;
+	delete[] mArenaOwned;  // After the packet handlers which use it
+}
+
+void CTasClientRwBase::mMoveFrom(CTasClientRwBase& other)
+{
+	mEi = other.mEi;
+	mMbIfRw = other.mMbIfRw;
+	mTimeoutMs = other.mTimeoutMs;
+
+	// The arena is not copied, all pointers into it stay valid
+	mTphRw = std::exchange(other.mTphRw, nullptr);
+	mTphRwPipe = std::exchange(other.mTphRwPipe, nullptr);
+	mTphRwPlan = std::exchange(other.mTphRwPlan, nullptr);
+	mArena = std::exchange(other.mArena, nullptr);
+	mArenaOwned = std::exchange(other.mArenaOwned, nullptr);
+	mRspBuf = std::exchange(other.mRspBuf, nullptr);
+	mRspBufSize = other.mRspBufSize;
+	mArenaSize = other.mArenaSize;
+	mTphArenaSize = other.mTphArenaSize;
+	mArenaMaxRqSize = other.mArenaMaxRqSize;
+	mArenaMaxNumRw = other.mArenaMaxNumRw;
+	mArenaNumTph = other.mArenaNumTph;
+	mTphMaxRspSize = other.mTphMaxRspSize;
+
+	mMemBudget = other.mMemBudget;
+	mMaxRspSizeDefault = other.mMaxRspSizeDefault;
+	mPackTight = other.mPackTight;
+
+	mPlanTrans = std::move(other.mPlanTrans);
+	mGsTrans = std::move(other.mGsTrans);
+	mGsTransRsp = std::move(other.mGsTransRsp);
+	mRmwTrans = std::move(other.mRmwTrans);
+	mRmwIdx = std::move(other.mRmwIdx);
+	mRmwState = std::move(other.mRmwState);
+
+	// The packet handlers report errors to the error info of this object
+	for (CTasPktHandlerRw* tph : { mTphRw, mTphRwPipe, mTphRwPlan }) {
+		if (tph)
+			tph->set_error_info(&mEi);
+	}
 }
 
-CTasClientRwBase::CTasClientRwBase(CTasPktMailboxIf* mb_if, uint32_t max_rq_size, uint32_t max_rsp_size, uint32_t max_num_rw)
-	: mRspBuf(max_rsp_size / 4),
-	  mMbIfRw(mb_if)
+CTasClientRwBase::CTasClientRwBase(CTasPktMailboxIf* mb_if, uint32_t max_rq_size, uint32_t max_rsp_size, uint32_t max_num_rw, void* arena)
+	: mMbIfRw(mb_if),
+	  mMaxRspSizeDefault(max_rsp_size)
 {
+	mInitArena(max_rq_size, max_rsp_size, max_num_rw, arena);
 	mMbIfRw->config(mTimeoutMs, max_rsp_size);
-	mTphRw = new CTasPktHandlerRw(&mEi, max_rq_size, max_rsp_size, max_num_rw);
+	mTphMaxRspSize = max_rsp_size;
+	mTphRw = new CTasPktHandlerRw(&mEi, max_rq_size, mTphMaxRspSize, max_num_rw, mGetTphArena(0));
+}
+
+size_t CTasClientRwBase::get_arena_size(uint32_t max_rq_size, uint32_t max_rsp_size, uint32_t max_num_rw)
+{
+	return ((max_rsp_size + 7) & ~7u) + 2 * CTasPktHandlerRw::get_arena_size(max_rq_size, max_num_rw);
+}
+
+void CTasClientRwBase::mInitArena(uint32_t max_rq_size, uint32_t max_rsp_size, uint32_t max_num_rw, void* arena)
+{
+	assert(mArena == nullptr);
+	mTphArenaSize = CTasPktHandlerRw::get_arena_size(max_rq_size, max_num_rw);
+	if (arena == nullptr) {
+		// The second packet handler is only needed for pipelined execution and allocates on first use
+		mArenaNumTph = 1;
+		mArenaSize = ((max_rsp_size + 7) & ~7u) + mTphArenaSize;
+		mArenaOwned = new uint64_t[mArenaSize / 8];
+		arena = mArenaOwned;
+	}
+	else {
+		mArenaNumTph = 2;
+		mArenaSize = get_arena_size(max_rq_size, max_rsp_size, max_num_rw);
+	}
+	assert(((uintptr_t)arena % 8) == 0);
+	mArena = (uint8_t*)arena;
+	mRspBuf = (uint32_t*)mArena;
+	mRspBufSize = max_rsp_size & ~3u;
+	mArenaMaxRqSize = max_rq_size;
+	mArenaMaxNumRw = max_num_rw;
+}
+
+tas_return_et CTasClientRwBase::rw_set_mem_budget(size_t num_bytes)
+{
+	if (mArena) {
+		snprintf(mEi.info, TAS_INFO_STR_LEN, "ERROR: Memory budget has to be set before the session start");
+		mEi.tas_err = TAS_ERR_FN_USAGE;
+		return mEi.tas_err;
+	}
+	mMemBudget = num_bytes;
+	return tas_clear_error_info(&mEi);
+}
+
+void CTasClientRwBase::mInitSessionBuffers(const tas_con_info_st* con_info)
+{
+	assert(mTphRw == nullptr);
+
+	uint32_t numRw = con_info->pl0_max_num_rw;
+	if (mArena == nullptr) {
+		// At least one PL2 packet of the maximum size in each direction
+		auto sizeMin = [](uint32_t pkt_size) {
+			return std::max<uint32_t>((pkt_size + CTasPktHandlerRw::BUF_ALLOWANCE + 7) & ~7u, 4 * CTasPktHandlerRw::BUF_ALLOWANCE);
+		};
+		const uint32_t sizeMinRq = sizeMin(con_info->max_pl2rq_pkt_size);
+		const uint32_t sizeMinRsp = sizeMin(con_info->max_pl2rsp_pkt_size);
+
+		// The response buffer holds one PL2 packet, since responses are received per PL2 packet
+		uint32_t maxRqSize = std::max<uint32_t>(sizeMinRq,
+			(uint32_t)std::min<uint64_t>(CTasPktHandlerRw::PKT_BUF_SIZE_DEFAULT, (uint64_t)std::max<uint32_t>(numRw, 1) * sizeMinRq));
+		uint32_t maxRspSize = std::max(mMaxRspSizeDefault, sizeMinRsp);
+		if (mMemBudget > 0) {
+			// Budget is the response buffer plus the request buffers and transaction lists of both packet handlers
+			size_t sizeFixed = sizeMinRsp + 2 * CTasPktHandlerRw::get_arena_size(0, numRw);
+			size_t sizeBuf = (mMemBudget > sizeFixed) ? ((mMemBudget - sizeFixed) / 2) & ~(size_t)7 : 0;
+			sizeBuf = std::min<size_t>(sizeBuf, 0x40000000);
+			maxRqSize = std::max((uint32_t)sizeBuf, sizeMinRq);
+			maxRspSize = std::max((uint32_t)sizeBuf, sizeMinRsp);
+		}
+		mInitArena(maxRqSize, sizeMinRsp, numRw, nullptr);
+		mMbIfRw->config(mTimeoutMs, mRspBufSize);
+		mTphMaxRspSize = maxRspSize;
+	}
+	assert(numRw <= mArenaMaxNumRw);
+	assert(mArenaMaxRqSize >= con_info->max_pl2rq_pkt_size + CTasPktHandlerRw::BUF_ALLOWANCE);
+	assert(mRspBufSize >= con_info->max_pl2rsp_pkt_size);
+
+	mTphRw = new CTasPktHandlerRw(&mEi, mArenaMaxRqSize, mTphMaxRspSize, numRw, mGetTphArena(0));
+	mTphRw->set_con_info(con_info);
+	mTphRw->rw_set_pack_tight(mPackTight);
+}
+
+void CTasClientRwBase::rw_set_pack_tight(bool enable)
+{
+	mPackTight = enable;
+	if (mTphRw)
+		mTphRw->rw_set_pack_tight(enable);
+	if (mTphRwPipe)
+		mTphRwPipe->rw_set_pack_tight(enable);
 }
 
 tas_return_et CTasClientRwBase::target_ping(tas_con_info_st* con_info)
@@ -52,10 +213,10 @@ tas_return_et CTasClientRwBase::target_ping(tas_con_info_st* con_info)
 		return TAS_ERR_FN_USAGE;
 	}
 
-	if (const uint32_t* pktRq = mTphRw->get_pkt_rq_ping(TAS_PL1_CMD_PING); !mMbIfRw->execute(pktRq, mRspBuf.data()))
+	if (const uint32_t* pktRq = mTphRw->get_pkt_rq_ping(TAS_PL1_CMD_PING); !mMbIfRw->execute(pktRq, mRspBuf))
 		return tas_client_handle_error_server_con(&mEi);
 
-	if (mTphRw->set_pkt_rsp_ping(TAS_PL1_CMD_PING, TAS_CLIENT_TYPE_RW, mRspBuf.data())) {
+	if (mTphRw->set_pkt_rsp_ping(TAS_PL1_CMD_PING, TAS_CLIENT_TYPE_RW, mRspBuf)) {
 		return mEi.tas_err;
 	}
 
@@ -128,6 +289,74 @@ tas_return_et CTasClientRwBase::write(uint64_t addr, const void* data, uint32_t
 	return mExecuteSingleTrans(&trans, num_bytes_ok);
 }
 
+tas_return_et CTasClientRwBase::read_large(uint64_t addr, void* data, uint32_t num_bytes, uint32_t* num_bytes_ok, uint8_t addr_map,
+											tas_rw_progress_ft progress, void* context)
+{
+	return mExecuteLargeTrans(TAS_RW_TT_RD, addr, data, num_bytes, num_bytes_ok, addr_map, progress, context);
+}
+
+tas_return_et CTasClientRwBase::write_large(uint64_t addr, const void* data, uint32_t num_bytes, uint32_t* num_bytes_ok, uint8_t addr_map,
+											 tas_rw_progress_ft progress, void* context)
+{
+	return mExecuteLargeTrans(TAS_RW_TT_WR, addr, const_cast<void*>(data), num_bytes, num_bytes_ok, addr_map, progress, context);
+}
+
+tas_return_et CTasClientRwBase::mExecuteLargeTrans(tas_rw_trans_type_et type, uint64_t addr, void* data, uint32_t num_bytes, uint32_t* num_bytes_ok,
+												   uint8_t addr_map, tas_rw_progress_ft progress, void* context)
+{
+	if (num_bytes_ok)
+		*num_bytes_ok = 0;
+
+	// Several transactions per chunk keep the chunks well filled.
+	// The first one ends at a transaction size boundary so that all following are aligned.
+	const uint32_t numBytesPerTrans = mGetNumBytesPerLargeTrans();
+
+	std::vector<tas_rw_trans_st> trans;
+	trans.reserve((num_bytes / numBytesPerTrans) + 2);
+	uint64_t a = addr;
+	uint32_t nb = num_bytes;
+	auto d = (uint8_t*)data;
+	while (nb > 0) {
+		uint32_t nbTrans = numBytesPerTrans - (uint32_t)(a % numBytesPerTrans);
+		if (nbTrans > nb)
+			nbTrans = nb;
+		tas_rw_trans_st tr = { a, nbTrans, 0, addr_map, type };
+		if (type == TAS_RW_TT_RD)
+			tr.rdata = d;
+		else
+			tr.wdata = d;
+		trans.push_back(tr);
+		a += nbTrans; d += nbTrans; nb -= nbTrans;
+	}
+
+	std::vector<tas_rw_trans_rsp_st> transRsp(trans.size());
+	tas_return_et ret = mExecuteTransPipelined(trans.data(), (uint32_t)trans.size(), transRsp.data(), true, progress, context);
+
+	if (num_bytes_ok) {
+		uint32_t numBytesOk = 0;
+		for (const auto& rsp : transRsp) {
+			numBytesOk += rsp.num_bytes_ok;
+			if (rsp.pl_err != TAS_PL0_ERR_NO_ERROR)
+				break;
+		}
+		*num_bytes_ok = numBytesOk;
+	}
+
+	return ret;
+}
+
+uint32_t CTasClientRwBase::mGetNumBytesPerLargeTrans() const
+{
+	uint32_t numBytesPerTrans = TAS_PL0_DATA_BLK_SIZE * 4;
+	if (mTphRw) {
+		uint32_t maxRqSize, maxRspSize, maxNumRw;
+		mTphRw->rw_get_limits(&maxRqSize, &maxRspSize, &maxNumRw);
+		if (std::min(maxRqSize, maxRspSize) < 2 * numBytesPerTrans)
+			numBytesPerTrans = TAS_PL0_DATA_BLK_SIZE;  // Still fits with the minimum buffer size
+	}
+	return numBytesPerTrans;
+}
+
 tas_return_et CTasClientRwBase::fill32(uint64_t addr, uint32_t value, uint32_t num_bytes, uint8_t addr_map)
 {
 	if (addr % 4) {
@@ -190,20 +419,237 @@ tas_return_et CTasClientRwBase::fill64(uint64_t addr, uint64_t value, uint32_t n
 
 tas_return_et CTasClientRwBase::mExecuteSingleTrans(const tas_rw_trans_st* trans, uint32_t* num_bytes_ok)
 {
-	if (tas_return_et ret = execute_trans(trans, 1); ret != TAS_ERR_NONE)
-	{
-		if (num_bytes_ok)
-			*num_bytes_ok = 0;
-		return ret;
-	}
+	if (num_bytes_ok)
+		*num_bytes_ok = 0;
 
-	const tas_rw_trans_rsp_st* transRsp;
-	uint32_t numTrans = rw_get_trans_rsp(&transRsp);
-	assert(numTrans == 1);
-	_unused(numTrans);
+	const uint32_t* rq;
+	uint32_t rqNumBytes;
+	uint32_t rspNumBytes;
+	uint32_t numPl2Pkt;
+	if (!mTphRw || !mTphRw->rw_set_trans_single(trans, &rq, &rqNumBytes, &rspNumBytes, &numPl2Pkt))
+		return execute_trans(trans, 1);  // Sets the error info
 
-	if (num_bytes_ok)
+	if (mExecuteRq(mTphRw, rq, numPl2Pkt) != TAS_ERR_NONE)
+		return mEi.tas_err;
+
+	if (num_bytes_ok) {
+		const tas_rw_trans_rsp_st* transRsp;
+		uint32_t numTrans = rw_get_trans_rsp(&transRsp);
+		assert(numTrans == 1);
+		_unused(numTrans);
 		*num_bytes_ok = transRsp[0].num_bytes_ok;
+	}
+
+	return tas_clear_error_info(&mEi);
+}
+
+tas_return_et CTasClientRwBase::fill_pattern(uint64_t addr, const void* pattern, uint32_t pattern_len, uint32_t num_bytes, uint8_t addr_map)
+{
+	if ((pattern_len == 0) || (pattern_len > TAS_PL0_DATA_BLK_SIZE)) {
+		snprintf(mEi.info, TAS_INFO_STR_LEN, "ERROR: pattern_len has to be between 1 and 1024 for fill_pattern()");
+		return TAS_ERR_FN_PARAM;
+	}
+	if (num_bytes == 0) {
+		snprintf(mEi.info, TAS_INFO_STR_LEN, "ERROR: num_bytes has to be greater than 0 for fill_pattern()");
+		return TAS_ERR_FN_PARAM;
+	}
+
+	auto pat = (const uint8_t*)pattern;
+
+	// Reduce the pattern to its shortest period which divides 8, so that FILL can be used
+	uint32_t patLen = pattern_len;
+	for (uint32_t period = 1; period <= 8; period *= 2) {
+		if ((patLen % period) || (patLen == period))
+			continue;
+		uint32_t i = period;
+		while ((i < patLen) && (pat[i] == pat[i % period]))
+			i++;
+		if (i == patLen) {
+			patLen = period;
+			break;
+		}
+	}
+
+	const uint32_t numBytesPerWrTrans = mGetNumBytesPerLargeTrans();
+	constexpr uint32_t numBytesPerFillTrans = TAS_PL0_DATA_BLK_SIZE * 32;
+
+	// The write transactions reference this buffer at the pattern phase of their start address
+	uint32_t numBytesWrMax = (num_bytes < numBytesPerWrTrans) ? num_bytes : numBytesPerWrTrans;
+	std::vector<uint8_t> patBuf(patLen + numBytesWrMax);
+	for (uint32_t i = 0; i < patBuf.size(); i++)
+		patBuf[i] = pat[i % patLen];
+
+	std::vector<tas_rw_trans_st> trans;
+	auto addWr = [&](uint64_t a, uint32_t nb) {
+		while (nb > 0) {
+			uint32_t nbTrans = (nb > numBytesPerWrTrans) ? numBytesPerWrTrans : nb;
+			uint32_t phase = (uint32_t)((a - addr) % patLen);
+			trans.push_back(tas_rw_trans_st{ a, nbTrans, 0, addr_map, TAS_RW_TT_WR, &patBuf[phase] });
+			a += nbTrans; nb -= nbTrans;
+		}
+	};
+
+	uint64_t value64;
+	if ((8 % patLen == 0) && (addr_map < TAS_AM12)) {
+		uint32_t numBytesHead = (uint32_t)((8 - (addr % 8)) % 8);
+		if (numBytesHead > num_bytes)
+			numBytesHead = num_bytes;
+		uint32_t numBytesBody = ((num_bytes - numBytesHead) / 8) * 8;
+
+		addWr(addr, numBytesHead);
+
+		uint64_t a = addr + numBytesHead;
+		auto value8 = (uint8_t*)&value64;
+		for (uint32_t i = 0; i < 8; i++)
+			value8[i] = pat[(numBytesHead + i) % patLen];
+		for (uint32_t nb = numBytesBody; nb > 0; ) {
+			uint32_t nbTrans = (nb > numBytesPerFillTrans) ? numBytesPerFillTrans : nb;
+			trans.push_back(tas_rw_trans_st{ a, nbTrans, 0, addr_map, TAS_RW_TT_FILL, &value64 });
+			a += nbTrans; nb -= nbTrans;
+		}
+
+		addWr(a, num_bytes - numBytesHead - numBytesBody);
+	}
+	else {
+		addWr(addr, num_bytes);
+	}
+
+	return mExecuteTransPipelined(trans.data(), (uint32_t)trans.size(), nullptr, true);
+}
+
+tas_return_et CTasClientRwBase::gather8(const uint64_t* addrs, uint8_t* values, uint32_t num, uint64_t* err_bitmap, uint8_t addr_map)
+{
+	return mGatherScatter(TAS_RW_TT_RD, addrs, values, sizeof(uint8_t), num, err_bitmap, addr_map);
+}
+
+tas_return_et CTasClientRwBase::scatter8(const uint64_t* addrs, const uint8_t* values, uint32_t num, uint64_t* err_bitmap, uint8_t addr_map)
+{
+	return mGatherScatter(TAS_RW_TT_WR, addrs, const_cast<uint8_t*>(values), sizeof(uint8_t), num, err_bitmap, addr_map);
+}
+
+tas_return_et CTasClientRwBase::gather16(const uint64_t* addrs, uint16_t* values, uint32_t num, uint64_t* err_bitmap, uint8_t addr_map)
+{
+	return mGatherScatter(TAS_RW_TT_RD, addrs, values, sizeof(uint16_t), num, err_bitmap, addr_map);
+}
+
+tas_return_et CTasClientRwBase::scatter16(const uint64_t* addrs, const uint16_t* values, uint32_t num, uint64_t* err_bitmap, uint8_t addr_map)
+{
+	return mGatherScatter(TAS_RW_TT_WR, addrs, const_cast<uint16_t*>(values), sizeof(uint16_t), num, err_bitmap, addr_map);
+}
+
+tas_return_et CTasClientRwBase::gather32(const uint64_t* addrs, uint32_t* values, uint32_t num, uint64_t* err_bitmap, uint8_t addr_map)
+{
+	return mGatherScatter(TAS_RW_TT_RD, addrs, values, sizeof(uint32_t), num, err_bitmap, addr_map);
+}
+
+tas_return_et CTasClientRwBase::scatter32(const uint64_t* addrs, const uint32_t* values, uint32_t num, uint64_t* err_bitmap, uint8_t addr_map)
+{
+	return mGatherScatter(TAS_RW_TT_WR, addrs, const_cast<uint32_t*>(values), sizeof(uint32_t), num, err_bitmap, addr_map);
+}
+
+tas_return_et CTasClientRwBase::gather64(const uint64_t* addrs, uint64_t* values, uint32_t num, uint64_t* err_bitmap, uint8_t addr_map)
+{
+	return mGatherScatter(TAS_RW_TT_RD, addrs, values, sizeof(uint64_t), num, err_bitmap, addr_map);
+}
+
+tas_return_et CTasClientRwBase::scatter64(const uint64_t* addrs, const uint64_t* values, uint32_t num, uint64_t* err_bitmap, uint8_t addr_map)
+{
+	return mGatherScatter(TAS_RW_TT_WR, addrs, const_cast<uint64_t*>(values), sizeof(uint64_t), num, err_bitmap, addr_map);
+}
+
+tas_return_et CTasClientRwBase::mGatherScatter(tas_rw_trans_type_et type, const uint64_t* addrs, void* values, uint32_t num_bytes, uint32_t num,
+												uint64_t* err_bitmap, uint8_t addr_map)
+{
+	auto v = (uint8_t*)values;
+	if (type == TAS_RW_TT_RD)
+		memset(v, 0, (size_t)num * num_bytes);  // Default in case of errors
+
+	mGsTrans.resize(num);
+	mGsTransRsp.resize(num);
+	for (uint32_t i = 0; i < num; i++) {
+		tas_rw_trans_st& tr = mGsTrans[i];
+		tr.addr = addrs[i];
+		tr.num_bytes = num_bytes;
+		tr.acc_mode = 0;
+		tr.addr_map = addr_map;
+		tr.type = type;
+		tr.rdata = &v[i * num_bytes];
+	}
+
+	tas_return_et ret = mExecuteTransPipelined(mGsTrans.data(), num, mGsTransRsp.data(), false);
+
+	if (err_bitmap) {
+		memset(err_bitmap, 0, ((num + 63) / 64) * sizeof(uint64_t));
+		for (uint32_t i = 0; i < num; i++) {
+			if (mGsTransRsp[i].pl_err != TAS_PL0_ERR_NO_ERROR)
+				err_bitmap[i / 64] |= 1ULL << (i % 64);
+		}
+	}
+
+	return ret;
+}
+
+tas_return_et CTasClientRwBase::rmw_batch32(const tas_rw_rmw32_st* rmw, uint32_t num_rmw, bool verify, uint8_t addr_map)
+{
+	for (uint32_t i = 0; i < num_rmw; i++) {
+		if (rmw[i].addr % 4) {
+			snprintf(mEi.info, TAS_INFO_STR_LEN, "ERROR: addr 0x%" PRIX64 " has to be 32 bit aligned for rmw_batch32()", rmw[i].addr);
+			return TAS_ERR_FN_PARAM;
+		}
+	}
+
+	mRmwState.resize(num_rmw);
+	mRmwTrans.resize(num_rmw);
+	for (uint32_t i = 0; i < num_rmw; i++)
+		mRmwTrans[i] = tas_rw_trans_st{ rmw[i].addr, 4, 0, addr_map, TAS_RW_TT_RD, &mRmwState[i].value };
+
+	if (tas_return_et ret = mExecuteTransPipelined(mRmwTrans.data(), num_rmw, nullptr, true); ret != TAS_ERR_NONE)
+		return ret;  // Nothing was written
+
+	// Entries with the same address are applied in order to the value which was read for the first one.
+	// Only the last entry of an address is written.
+	mRmwIdx.resize(num_rmw);
+	std::iota(mRmwIdx.begin(), mRmwIdx.end(), 0);
+	std::sort(mRmwIdx.begin(), mRmwIdx.end(), [rmw](uint32_t a, uint32_t b) {
+		return (rmw[a].addr < rmw[b].addr) || ((rmw[a].addr == rmw[b].addr) && (a < b));
+	});
+	for (uint32_t k = 0; k < num_rmw; ) {
+		const uint64_t addr = rmw[mRmwIdx[k]].addr;
+		uint32_t v = mRmwState[mRmwIdx[k]].value;
+		uint32_t m = 0;
+		uint32_t i;
+		do {
+			i = mRmwIdx[k];
+			v = (v & ~rmw[i].mask) | (rmw[i].value & rmw[i].mask);
+			m |= rmw[i].mask;
+			mRmwState[i].last = false;
+			k++;
+		} while ((k < num_rmw) && (rmw[mRmwIdx[k]].addr == addr));
+		mRmwState[i] = { v, m, 0, true };
+	}
+
+	// Each verify read directly follows the write of its address
+	mRmwTrans.clear();
+	for (uint32_t i = 0; i < num_rmw; i++) {
+		if (!mRmwState[i].last)
+			continue;
+		mRmwTrans.push_back(tas_rw_trans_st{ rmw[i].addr, 4, 0, addr_map, TAS_RW_TT_WR, &mRmwState[i].value });
+		if (verify)
+			mRmwTrans.push_back(tas_rw_trans_st{ rmw[i].addr, 4, 0, addr_map, TAS_RW_TT_RD, &mRmwState[i].value_rb });
+	}
+
+	if (tas_return_et ret = mExecuteTransPipelined(mRmwTrans.data(), (uint32_t)mRmwTrans.size(), nullptr, true); ret != TAS_ERR_NONE)
+		return ret;
+
+	for (uint32_t i = 0; verify && (i < num_rmw); i++) {
+		const tas_rmw32_state_st& st = mRmwState[i];
+		if (st.last && ((st.value_rb ^ st.value) & st.mask)) {
+			snprintf(mEi.info, TAS_INFO_STR_LEN, "ERROR: Verify failed at addr 0x%" PRIX64 ", expected 0x%8.8" PRIX32 ", read 0x%8.8" PRIX32 ", mask 0x%8.8" PRIX32,
+				rmw[i].addr, st.value, st.value_rb, st.mask);
+			mEi.tas_err = TAS_ERR_RW_WRITE;
+			return TAS_ERR_RW_WRITE;
+		}
+	}
 
 	return tas_clear_error_info(&mEi);
 }
@@ -217,14 +663,15 @@ tas_return_et CTasClientRwBase::execute_trans(const tas_rw_trans_st* trans, uint
 
 	if (!mTphRw->rw_set_trans(trans, num_trans)) 
 	{
-		std::array<char, TAS_INFO_STR_LEN/2> transStr;
-		const char* typeStr = (trans->type == TAS_RW_TT_RD) ? "RD" : "WR";
-		snprintf(transStr.data(), TAS_INFO_STR_LEN/2, "%s addr=0x%" PRIX64 ", num_bytes=%" PRIu32 ", acc_mode=0x%4.4" PRIX16 ", addr_map=%" PRIu8,
-			typeStr, trans->addr, trans->num_bytes, trans->acc_mode, trans->addr_map);
-		if (num_trans == 1)
-			snprintf(mEi.info, TAS_INFO_STR_LEN, "ERROR: Failed to add %s", transStr.data());
-		else
-			snprintf(mEi.info, TAS_INFO_STR_LEN, "ERROR: Failed to add %" PRIu32 " trans (first %s)", num_trans, transStr.data());
+		// Rendered on demand by tas_get_error_info()
+		mEi.info[0] = 0;
+		mEi.pending = TAS_EI_PENDING_ADD_TRANS;
+		mEi.trans_type = trans->type;
+		mEi.addr = trans->addr;
+		mEi.num_bytes = trans->num_bytes;
+		mEi.acc_mode = trans->acc_mode;
+		mEi.addr_map = trans->addr_map;
+		mEi.num_trans = num_trans;
 		return TAS_ERR_FN_PARAM;
 	}
 
@@ -234,19 +681,432 @@ tas_return_et CTasClientRwBase::execute_trans(const tas_rw_trans_st* trans, uint
 	uint32_t numPl2Pkt;
 	mTphRw->rw_get_rq(&rq, &rqNumBytes, &rspNumBytes, &numPl2Pkt);
 
+	return mExecuteRq(mTphRw, rq, numPl2Pkt);
+}
+
+tas_return_et CTasClientRwBase::execute_trans_unbounded(const tas_rw_trans_st* trans, uint32_t num_trans, tas_rw_trans_rsp_st* trans_rsp)
+{
+	return mExecuteTransPipelined(trans, num_trans, trans_rsp, false);
+}
+
+tas_return_et CTasClientRwBase::mExecuteTransPipelined(const tas_rw_trans_st* trans, uint32_t num_trans, tas_rw_trans_rsp_st* trans_rsp,
+													   bool stop_on_error, tas_rw_progress_ft progress, void* context)
+{
+	if (!mTphRw) {
+		snprintf(mEi.info, TAS_INFO_STR_LEN, "ERROR: Session not yet started");
+		return TAS_ERR_FN_USAGE;
+	}
+
+	if (trans_rsp) {
+		for (uint32_t t = 0; t < num_trans; t++)
+			trans_rsp[t] = { 0, TAS_PL_ERR_PROTOCOL };
+	}
+
+	mInitTphRwPipe();
+
+	// Two chunks can be in flight. Chunk c uses tph[c % 2].
+	CTasPktHandlerRw* tph[2] = { mTphRw, mTphRwPipe };
+	uint32_t chunkFirst[2] = {};
+	uint32_t chunkNumPl2Pkt[2] = {};
+	bool chunkInFlight[2] = {};
+
+	tas_return_et ret = TAS_ERR_NONE;
+	tas_error_info_st eiFirst;
+
+	uint32_t numBytesDone = 0;
+	uint32_t numBytesTotal = 0;
+	if (progress) {
+		for (uint32_t i = 0; i < num_trans; i++)
+			numBytesTotal += trans[i].num_bytes;
+	}
+
+	uint32_t t = 0;
+	uint32_t cur = 0;
+	while ((t < num_trans) || chunkInFlight[0] || chunkInFlight[1]) {
+
+		if (t < num_trans) {
+			tph[cur]->rw_start();
+			uint32_t numAdded = tph[cur]->rw_add_trans(&trans[t], num_trans - t);
+			if (numAdded == 0) {
+				// A single transaction which does not fit into the packet buffers
+				if (ret == TAS_ERR_NONE) {
+					snprintf(eiFirst.info, TAS_INFO_STR_LEN, "ERROR: Failed to add trans %" PRIu32 " addr=0x%" PRIX64 ", num_bytes=%" PRIu32,
+						t, trans[t].addr, trans[t].num_bytes);
+					eiFirst.tas_err = TAS_ERR_FN_PARAM;
+					ret = TAS_ERR_FN_PARAM;
+				}
+				t = num_trans;  // Stop sending, outstanding chunk is still received
+			}
+			else {
+				const uint32_t* rq;
+				uint32_t rqNumBytes;
+				uint32_t rspNumBytes;
+				tph[cur]->rw_get_rq(&rq, &rqNumBytes, &rspNumBytes, &chunkNumPl2Pkt[cur]);
+				if (!mMbIfRw->send(rq, chunkNumPl2Pkt[cur]))
+					return tas_client_handle_error_server_con(&mEi);
+				chunkFirst[cur] = t;
+				chunkInFlight[cur] = true;
+				t += numAdded;
+			}
+		}
+
+		uint32_t prev = cur ^ 1;
+		if (chunkInFlight[prev]) {
+			if (mReceiveParseRsp(tph[prev], chunkNumPl2Pkt[prev]) != TAS_ERR_NONE) {
+				if (mEi.tas_err == TAS_ERR_SERVER_CON)
+					return mEi.tas_err;
+				if (ret == TAS_ERR_NONE) {
+					eiFirst = mEi;
+					ret = mEi.tas_err;
+				}
+				if (stop_on_error)
+					t = num_trans;
+			}
+
+			const tas_rw_trans_rsp_st* chunkRsp;
+			uint32_t numChunkTrans = tph[prev]->rw_get_trans_rsp(&chunkRsp);
+			assert(chunkFirst[prev] + numChunkTrans <= num_trans);
+			if (trans_rsp)
+				std::copy(chunkRsp, chunkRsp + numChunkTrans, &trans_rsp[chunkFirst[prev]]);
+			chunkInFlight[prev] = false;
+
+			if (progress) {
+				for (uint32_t i = 0; i < numChunkTrans; i++)
+					numBytesDone += trans[chunkFirst[prev] + i].num_bytes;
+				progress(numBytesDone, numBytesTotal, context);
+			}
+		}
+		cur = prev;
+	}
+
+	if (ret != TAS_ERR_NONE) {
+		mEi = eiFirst;
+		return ret;
+	}
+
+	return tas_clear_error_info(&mEi);
+}
+
+void CTasClientRwBase::mInitTphRwPipe()
+{
+	assert(mTphRw);
+	if (!mTphRwPipe) {
+		uint32_t maxRqSize, maxRspSize, maxNumRw;
+		mTphRw->rw_get_limits(&maxRqSize, &maxRspSize, &maxNumRw);
+		void* arena = nullptr;  // Allocated by the packet handler if the arena only holds the first one
+		if (mArenaNumTph == 2) {
+			assert(CTasPktHandlerRw::get_arena_size(maxRqSize, maxNumRw) <= mTphArenaSize);
+			arena = mGetTphArena(1);
+		}
+		mTphRwPipe = new CTasPktHandlerRw(&mEi, maxRqSize, maxRspSize, maxNumRw, arena);
+	}
+	mTphRwPipe->set_con_info(mTphRw->get_con_info());
+	mTphRwPipe->rw_set_pack_tight(mPackTight);
+}
+
+tas_return_et CTasClientRwBase::execute_trans_best_effort(const tas_rw_trans_st* trans, uint32_t num_trans, tas_pl_err_et8* pl_err,
+														  uint32_t* num_bytes_ok, uint32_t* num_failed)
+{
+	if (num_failed)
+		*num_failed = num_trans;
+
+	// Transactions which are not executed
+	for (uint32_t i = 0; i < num_trans; i++) {
+		if (pl_err)
+			pl_err[i] = TAS_PL_ERR_PROTOCOL;
+		if (num_bytes_ok)
+			num_bytes_ok[i] = 0;
+	}
+
+	if (!mTphRw) {
+		snprintf(mEi.info, TAS_INFO_STR_LEN, "ERROR: Session not yet started");
+		return TAS_ERR_FN_USAGE;
+	}
+
+	mInitTphRwPipe();
+
+	std::vector<tas_rw_trans_rsp_st> transRsp;
+	std::vector<tas_rw_trans_st> passTrans, retryTrans;
+	std::vector<uint32_t> passIdx, retryIdx;
+	std::vector<uint32_t> passOfs, retryOfs;  // Offset of a part in its transaction
+
+	// Transactions above CTasPktHandlerRw::MAX_NUM_BYTES_RW are executed in consecutive parts.
+	// The parts of a transaction are consecutive in a pass.
+	const uint32_t numBytesPart = 0x8000;
+	auto addParts = [&](uint32_t i, uint32_t ofs) {
+		const tas_rw_trans_st& tr = trans[i];
+		do {
+			tas_rw_trans_st part = tr;
+			part.addr += ofs;
+			part.num_bytes = tr.num_bytes - ofs;
+			if (part.num_bytes > CTasPktHandlerRw::MAX_NUM_BYTES_RW)
+				part.num_bytes = numBytesPart;
+			if (tr.type == TAS_RW_TT_RD)
+				part.rdata = (uint8_t*)tr.rdata + ofs;
+			else if (tr.type == TAS_RW_TT_WR)
+				part.wdata = (const uint8_t*)tr.wdata + ofs;
+			retryTrans.push_back(part);
+			retryIdx.push_back(i);
+			retryOfs.push_back(ofs);
+			ofs += part.num_bytes;
+		} while (ofs < tr.num_bytes);
+	};
+
+	// The first pass is the whole list. Following passes contain the skipped transactions.
+	for (uint32_t i = 0; i < num_trans; i++)
+		addParts(i, 0);
+	uint32_t numFailed = 0;
+	tas_return_et ret = TAS_ERR_NONE;
+	while (!retryTrans.empty()) {
+		std::swap(passTrans, retryTrans);
+		std::swap(passIdx, retryIdx);
+		std::swap(passOfs, retryOfs);
+		retryTrans.clear();
+		retryIdx.clear();
+		retryOfs.clear();
+
+		const uint32_t numPass = (uint32_t)passTrans.size();
+		transRsp.resize(numPass);
+		ret = mExecuteTransPipelined(passTrans.data(), numPass, transRsp.data(), false);
+		bool conLost = (ret == TAS_ERR_SERVER_CON);  // Not executed transactions return TAS_PL_ERR_PROTOCOL
+
+		for (uint32_t k = 0; k < numPass; ) {
+			const uint32_t i = passIdx[k];
+			// The first failed part decides, the following parts of the transaction are discarded
+			uint32_t numBytesOk = passOfs[k];
+			tas_pl_err_et8 plErr = TAS_PL0_ERR_NO_ERROR;
+			for (; (k < numPass) && (passIdx[k] == i); k++) {
+				if (plErr != TAS_PL0_ERR_NO_ERROR)
+					continue;
+				numBytesOk = passOfs[k] + transRsp[k].num_bytes_ok;
+				plErr = transRsp[k].pl_err;
+			}
+			if ((plErr == TAS_PL0_ERR_CONSEQUENTIAL) && !conLost) {
+				// Resume after the part of the transaction which was already executed
+				addParts(i, numBytesOk);
+				continue;
+			}
+			if (pl_err)
+				pl_err[i] = plErr;
+			if (num_bytes_ok)
+				num_bytes_ok[i] = numBytesOk;
+			if (plErr != TAS_PL0_ERR_NO_ERROR)
+				numFailed++;
+		}
+
+		if (conLost)
+			break;
+
+		if ((retryIdx == passIdx) && (retryOfs == passOfs)) {
+			// No progress, keep the skipped state
+			for (uint32_t r = 0; r < retryIdx.size(); r++) {
+				if ((r > 0) && (retryIdx[r] == retryIdx[r - 1]))
+					continue;  // Further part of the same transaction
+				if (pl_err)
+					pl_err[retryIdx[r]] = TAS_PL0_ERR_CONSEQUENTIAL;
+				if (num_bytes_ok)
+					num_bytes_ok[retryIdx[r]] = retryOfs[r];
+				numFailed++;
+			}
+			break;
+		}
+	}
+
+	if (num_failed)
+		*num_failed = numFailed;
+
+	if (ret == TAS_ERR_SERVER_CON)
+		return ret;
+
+	return tas_clear_error_info(&mEi);
+}
+
+tas_return_et CTasClientRwBase::mReceiveParseRsp(CTasPktHandlerRw* tph, uint32_t num_pl2_pkt)
+{
+	// Each PL2 packet is parsed as soon as it is received, while the following packets are still on the wire
+	tph->rw_set_rsp_begin();
+	tas_return_et ret = TAS_ERR_NONE;
+	for (uint32_t p = 0; p < num_pl2_pkt; p++) {
+		uint32_t numBytes;
+		if (!mMbIfRw->receive(mRspBuf, &numBytes))
+			return tas_client_handle_error_server_con(&mEi);
+		assert(numBytes % 4 == 0);
+		if ((ret == TAS_ERR_NONE) || (ret == TAS_ERR_RW_READ) || (ret == TAS_ERR_RW_WRITE))
+			ret = tph->rw_set_rsp_pl2(mRspBuf, numBytes);
+		// Otherwise the remaining packets are only received to keep the connection in sync
+	}
+	return ret;
+}
+
+tas_return_et CTasClientRwBase::mExecuteRq(CTasPktHandlerRw* tph, const uint32_t* rq, uint32_t num_pl2_pkt)
+{
+	if (num_pl2_pkt > 1) {
+		if (!mMbIfRw->send(rq, num_pl2_pkt))
+			return tas_client_handle_error_server_con(&mEi);
+		if (mReceiveParseRsp(tph, num_pl2_pkt) != TAS_ERR_NONE)
+			return mEi.tas_err;
+		return tas_clear_error_info(&mEi);
+	}
+
 	uint32_t rspNumBytesReceived = 0;
-	if (!mMbIfRw->execute(rq, mRspBuf.data(), numPl2Pkt, &rspNumBytesReceived))
+	if (!mMbIfRw->execute(rq, mRspBuf, num_pl2_pkt, &rspNumBytesReceived))
 		return tas_client_handle_error_server_con(&mEi);
 	assert(rspNumBytesReceived > 0);
 	assert(rspNumBytesReceived % 4 == 0);
-	assert(rspNumBytesReceived <= rspNumBytes);
+	assert(rspNumBytesReceived <= mRspBufSize);
 
-	if (mTphRw->rw_set_rsp(mRspBuf.data(), rspNumBytesReceived) != TAS_ERR_NONE)
+	if (tph->rw_set_rsp(mRspBuf, rspNumBytesReceived) != TAS_ERR_NONE)
 		return mEi.tas_err;
 
 	return tas_clear_error_info(&mEi);
 }
 
+tas_return_et CTasClientRwBase::prepare_trans(const tas_rw_trans_st* trans, uint32_t num_trans, CTasPreparedTrans* prepared)
+{
+	if (!mTphRw) {
+		snprintf(mEi.info, TAS_INFO_STR_LEN, "ERROR: Session not yet started");
+		return TAS_ERR_FN_USAGE;
+	}
+
+	delete prepared->mTphRw;
+	prepared->mTphRw = nullptr;
+	prepared->mClient = nullptr;
+	prepared->mNumPl2Pkt = 0;
+
+	// Same limits as the packet handler of this client
+	uint32_t maxRqSize, maxRspSize, maxNumRw;
+	mTphRw->rw_get_limits(&maxRqSize, &maxRspSize, &maxNumRw);
+	auto tphRw = new CTasPktHandlerRw(&mEi, maxRqSize, maxRspSize, maxNumRw);
+	tphRw->set_con_info(mTphRw->get_con_info());
+	tphRw->rw_set_pack_tight(mPackTight);
+
+	if (!tphRw->rw_set_trans(trans, num_trans)) {
+		delete tphRw;
+		snprintf(mEi.info, TAS_INFO_STR_LEN, "ERROR: Failed to prepare %" PRIu32 " trans", num_trans);
+		return TAS_ERR_FN_PARAM;
+	}
+
+	const uint32_t* rq;
+	uint32_t rqNumBytes;
+	uint32_t rspNumBytes;
+	tphRw->rw_get_rq(&rq, &rqNumBytes, &rspNumBytes, &prepared->mNumPl2Pkt);
+
+	prepared->mTphRw = tphRw;
+	prepared->mClient = this;
+
+	return tas_clear_error_info(&mEi);
+}
+
+tas_return_et CTasClientRwBase::execute_prepared(CTasPreparedTrans* prepared)
+{
+	if (!prepared->prepared() || (prepared->mClient != this)) {
+		snprintf(mEi.info, TAS_INFO_STR_LEN, "ERROR: Transaction list was not prepared by this client");
+		return TAS_ERR_FN_USAGE;
+	}
+
+	const uint32_t* rq;
+	uint32_t rqNumBytes;
+	uint32_t rspNumBytes;
+	uint32_t numPl2Pkt;
+	prepared->mTphRw->rw_rearm_rq(&rq, &rqNumBytes, &rspNumBytes, &numPl2Pkt);
+
+	return mExecuteRq(prepared->mTphRw, rq, numPl2Pkt);
+}
+
+tas_return_et CTasClientRwBase::plan_trans(const tas_rw_trans_st* trans, uint32_t num_trans, tas_rw_plan_st* plan,
+										   uint32_t options, CTasRwSpanPlanner* span_planner)
+{
+	*plan = {};
+
+	if (!mTphRw) {
+		snprintf(mEi.info, TAS_INFO_STR_LEN, "ERROR: Session not yet started");
+		return TAS_ERR_FN_USAGE;
+	}
+	if ((options & TAS_RW_PLAN_COALESCE) && !span_planner) {
+		snprintf(mEi.info, TAS_INFO_STR_LEN, "ERROR: Coalescing needs a span planner");
+		return TAS_ERR_FN_PARAM;
+	}
+	if ((options & TAS_RW_PLAN_PACK_TIGHT) && (options & TAS_RW_PLAN_PACK_GREEDY)) {
+		snprintf(mEi.info, TAS_INFO_STR_LEN, "ERROR: Tight and greedy packing are exclusive");
+		return TAS_ERR_FN_PARAM;
+	}
+
+	if (options & TAS_RW_PLAN_REORDER) {
+		mPlanTrans.assign(trans, trans + num_trans);
+		auto itRunStart = mPlanTrans.begin();
+		while (itRunStart != mPlanTrans.end()) {
+			auto itRunEnd = std::find_if(itRunStart, mPlanTrans.end(), [](const tas_rw_trans_st& t) { return t.type != TAS_RW_TT_RD; });
+			std::stable_sort(itRunStart, itRunEnd, [](const tas_rw_trans_st& a, const tas_rw_trans_st& b) {
+				if (a.addr_map != b.addr_map)
+					return a.addr_map < b.addr_map;
+				if (a.acc_mode != b.acc_mode)
+					return a.acc_mode < b.acc_mode;
+				return a.addr < b.addr;
+			});
+			itRunStart = (itRunEnd == mPlanTrans.end()) ? itRunEnd : itRunEnd + 1;
+		}
+		trans = mPlanTrans.data();
+	}
+	if (options & TAS_RW_PLAN_COALESCE)
+		trans = span_planner->plan(trans, num_trans, &num_trans);
+
+	// Same limits as the packet handler of this client
+	uint32_t maxRqSize, maxRspSize, maxNumRw;
+	mTphRw->rw_get_limits(&maxRqSize, &maxRspSize, &maxNumRw);
+	if (!mTphRwPlan)
+		mTphRwPlan = new CTasPktHandlerRw(&mEi, maxRqSize, maxRspSize, maxNumRw);
+	mTphRwPlan->set_con_info(mTphRw->get_con_info());
+	bool packTight = mPackTight;  // Same packing as execute_trans() unless an option selects it
+	if (options & TAS_RW_PLAN_PACK_TIGHT)
+		packTight = true;
+	else if (options & TAS_RW_PLAN_PACK_GREEDY)
+		packTight = false;
+	mTphRwPlan->rw_set_pack_tight(packTight);
+
+	plan->num_trans = num_trans;
+	uint32_t numTransDone = 0;
+	while (numTransDone < num_trans) {
+		mTphRwPlan->rw_start();
+		uint32_t numTransAdded = mTphRwPlan->rw_add_trans(&trans[numTransDone], num_trans - numTransDone);
+		if (numTransAdded == 0) {
+			const tas_rw_trans_st& t = trans[numTransDone];
+			snprintf(mEi.info, TAS_INFO_STR_LEN, "ERROR: Trans %" PRIu32 " exceeds the limits (addr=0x%" PRIX64 ", num_bytes=%" PRIu32 ")",
+					 numTransDone, t.addr, t.num_bytes);
+			return TAS_ERR_FN_PARAM;
+		}
+		numTransDone += numTransAdded;
+
+		const uint32_t* rq;
+		uint32_t rqNumBytes;
+		uint32_t rspNumBytes;
+		uint32_t numPl2Pkt;
+		mTphRwPlan->rw_get_rq(&rq, &rqNumBytes, &rspNumBytes, &numPl2Pkt);
+
+		plan->num_pl0_trans += mTphRwPlan->rw_get_num_pl0_trans();
+		plan->num_pl2_pkt += numPl2Pkt;
+		plan->num_round_trips++;
+		plan->rq_num_bytes += rqNumBytes;
+		plan->rsp_num_bytes += rspNumBytes;
+	}
+
+	return tas_clear_error_info(&mEi);
+}
+
+CTasPreparedTrans::~CTasPreparedTrans()
+{
+	delete mTphRw;
+}
+
+uint32_t CTasPreparedTrans::get_trans_rsp(const tas_rw_trans_rsp_st** trans_rsp)
+{
+	if (!mTphRw) {
+		assert(false);  // Wrong usage
+		return 0;
+	}
+
+	return mTphRw->rw_get_trans_rsp(trans_rsp);
+}
+
 uint32_t CTasClientRwBase::rw_get_trans_rsp(const tas_rw_trans_rsp_st** trans_rsp)
 {
 	if (!mTphRw) {
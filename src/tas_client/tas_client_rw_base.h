@@ -30,6 +30,84 @@
 
 // Standard includes
 #include <vector>
+#include <cassert>
+
+class CTasClientRwBase;
+class CTasRwSpanPlanner;
+
+//! \brief Encoding alternatives for \ref CTasClientRwBase::plan_trans()
+enum tas_rw_plan_option_et : uint32_t {
+	TAS_RW_PLAN_DEFAULT     = 0,	//!< \brief Encoding as with \ref CTasClientRwBase::execute_trans()
+	TAS_RW_PLAN_PACK_TIGHT  = 0x01,	//!< \brief Tight PL2 packet packing, see CTasPktHandlerRw::rw_set_pack_tight()
+	TAS_RW_PLAN_COALESCE    = 0x02,	//!< \brief Merge clustered reads with a \ref CTasRwSpanPlanner
+	TAS_RW_PLAN_REORDER     = 0x04,	//!< \brief Sort reads between two writes by address map, access mode and address
+	TAS_RW_PLAN_PACK_GREEDY = 0x08,	//!< \brief Greedy PL2 packet packing. Without a packing option the client setting is used.
+};
+
+//! \brief Figures of a transaction list which are computed by \ref CTasClientRwBase::plan_trans()
+struct tas_rw_plan_st {
+	uint32_t num_trans;			//!< \brief Number of transactions after coalescing
+	uint32_t num_pl0_trans;		//!< \brief Number of PL0 transactions
+	uint32_t num_pl2_pkt;		//!< \brief Number of PL2 packets
+	uint32_t num_round_trips;	//!< \brief Number of round trips if the list is split at the client limits
+	uint64_t rq_num_bytes;		//!< \brief Size of all PL2 request packets
+	uint64_t rsp_num_bytes;		//!< \brief Predicted size of all PL2 response packets without errors
+};
+
+//! \brief Progress callback for \ref CTasClientRwBase::read_large() and \ref CTasClientRwBase::write_large()
+//! \param num_bytes_done Number of bytes for which the response was received
+//! \param num_bytes_total Number of bytes of the whole operation
+//! \param context User pointer which was passed with the callback
+typedef void (*tas_rw_progress_ft)(uint32_t num_bytes_done, uint32_t num_bytes_total, void* context);
+
+//! \brief Read-modify-write operation for \ref CTasClientRwBase::rmw_batch32()
+struct tas_rw_rmw32_st {
+	uint64_t addr;		//!< \brief 64-bit address of the 32-bit register
+	uint32_t mask;		//!< \brief Bits which are modified
+	uint32_t value;		//!< \brief New value of the bits in mask
+};
+
+//! \brief A list of transactions which is encoded once and executed repeatedly.
+//! \details Created with \ref CTasClientRwBase::prepare_trans() and executed with \ref CTasClientRwBase::execute_prepared().
+//! The request packets are built only once. Each execution only copies the current write data from the buffers
+//! referenced by the transaction list and renews the PL1 counters. Read data is stored to the buffers referenced by the
+//! transaction list. These buffers have to stay valid as long as the object is used.
+//! An object can only be executed by the client which prepared it.
+class CTasPreparedTrans
+{
+
+public:
+	CTasPreparedTrans(const CTasPreparedTrans&) = delete; //!< \brief delete the copy constructor
+	CTasPreparedTrans operator= (const CTasPreparedTrans&) = delete; //!< \brief delete copy-assignment operator
+
+	//! \brief Prepared transaction list object constructor.
+	CTasPreparedTrans() = default;
+
+	//! \brief Prepared transaction list object destructor for cleanup.
+	~CTasPreparedTrans();
+
+	//! \brief Check if a transaction list was prepared.
+	//! \returns \c true if yes, otherwise \c false
+	bool prepared() const { return (mTphRw != nullptr); }
+
+	//! \brief Get the number of PL2 packets which are sent with each execution.
+	//! \returns the number of PL2 packets, 1 means the execution is atomic
+	uint32_t get_num_pl2_pkt() const { return mNumPl2Pkt; }
+
+	//! \brief Get the transaction responses of the last execution.
+	//! \details This method is for individual error handling or debugging.
+	//! \param trans_rsp pointer to a list of transaction responses
+	//! \returns the number of RW transactions
+	uint32_t get_trans_rsp(const tas_rw_trans_rsp_st** trans_rsp);
+
+private:
+
+	friend class CTasClientRwBase;
+
+	const CTasClientRwBase* mClient = nullptr;	//!< \brief Client which prepared and executes the transaction list
+	CTasPktHandlerRw* mTphRw = nullptr;			//!< \brief Packet handler object which holds the encoded request packets
+	uint32_t mNumPl2Pkt = 0;					//!< \brief Number of PL2 packets in the request
+};
 
 //! \brief Base class for read/write operations. 
 //! \details This API assumes that the timeout and the size and number of transactions are configured
@@ -46,11 +124,43 @@ public:
 
 	//! \brief Base class object constructor.
 	//! \param max_rsp_size Defines maximum response packet size
-	explicit CTasClientRwBase(uint32_t max_rsp_size);
+	//! \param arena Optional caller-supplied memory of get_arena_size(CTasPktHandlerRw::PKT_BUF_SIZE_DEFAULT, max_rsp_size,
+	//! CTasPktHandlerRw::MAX_NUM_RW_DEFAULT) bytes, 8 byte aligned. If nullptr, the memory is allocated at session start
+	//! and sized for the connection, see \ref rw_set_mem_budget().
+	explicit CTasClientRwBase(uint32_t max_rsp_size, void* arena = nullptr);
+
+	//! \brief Get the size of the memory arena of a read/write client
+	//! \details The arena holds the response buffer and the buffers of the two packet handlers which are used
+	//! for pipelined execution:\n
+	//! max_rsp_size + 2 * CTasPktHandlerRw::get_arena_size(max_rq_size, max_num_rw)\n
+	//! with max_rsp_size rounded up to a multiple of 8. With a caller-supplied arena, the single accesses,
+	//! read()/write() and execute_trans() do not allocate heap memory after the session start.
+	//! An internally allocated arena only holds the response buffer and the first packet handler. The second one
+	//! allocates its memory on the first pipelined execution.
+	//! The following still use the heap: each prepared transaction list owns a packet handler with its own arena,
+	//! plan_trans() creates its packet handler on first use, gather/scatter and rmw_batch32() reuse lists which grow to
+	//! the largest call, and read_large()/write_large(), fill_pattern() and execute_trans_best_effort() build
+	//! temporary transaction lists per call.
+	//! \param max_rq_size Maximum size of request packets
+	//! \param max_rsp_size Maximum size of response packets
+	//! \param max_num_rw Maximum number of read/write transactions
+	//! \returns the arena size in bytes, a multiple of 8
+	static size_t get_arena_size(uint32_t max_rq_size, uint32_t max_rsp_size, uint32_t max_num_rw);
 
 	//! \brief Base class object destructor. Used for cleanup.
 	~CTasClientRwBase();
 
+	//! \brief Base class move constructor. The packet handlers and the buffers are taken over.
+	//! \details Transaction lists which were prepared with the moved-from object have to be prepared again.
+	//! The moved-from object can only be destroyed or assigned to.
+	//! \param other object which is moved from
+	CTasClientRwBase(CTasClientRwBase&& other) noexcept;
+
+	//! \brief Base class move-assignment operator. The own packet handlers and buffers are released before.
+	//! \param other object which is moved from
+	//! \returns reference to this object
+	CTasClientRwBase& operator= (CTasClientRwBase&& other) noexcept;
+
 	//! \brief Execute an 8-bit read operation
 	//! \param addr 64-bit address at which the operation is performed
 	//! \param value Pointer to a data buffer to which the read data is stored
@@ -124,6 +234,33 @@ public:
 	//! \param addr_map Address map to be used, default: \ref TAS_AM0
 	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
 	tas_return_et write(uint64_t addr, const void* data, uint32_t num_bytes, uint32_t* num_bytes_ok, uint8_t addr_map = TAS_AM0);
+
+	//! \brief Execute a read operation which can exceed the packet buffer size
+	//! \details The read is split into packet buffer sized chunks. The next chunk is sent before the response of the
+	//! previous chunk was received. No further chunks are sent after an error.
+	//! \param addr 64-bit address at which the operation is performed
+	//! \param data Pointer to a data buffer to which the read data is stored
+	//! \param num_bytes Number of bytes to be read
+	//! \param num_bytes_ok Pointer to a variable holding the number of bytes read successfully from addr on
+	//! \param addr_map Address map to be used, default: \ref TAS_AM0
+	//! \param progress Optional callback which is called after each received chunk
+	//! \param context User pointer which is passed to progress
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et read_large(uint64_t addr, void* data, uint32_t num_bytes, uint32_t* num_bytes_ok, uint8_t addr_map = TAS_AM0,
+							 tas_rw_progress_ft progress = nullptr, void* context = nullptr);
+
+	//! \brief Execute a write operation which can exceed the packet buffer size
+	//! \details Same as \ref read_large() for writing.
+	//! \param addr 64-bit address at which the operation is performed
+	//! \param data Pointer to a data buffer from which the data is written
+	//! \param num_bytes Number of bytes to be written
+	//! \param num_bytes_ok Pointer to a variable holding the number of bytes written successfully from addr on
+	//! \param addr_map Address map to be used, default: \ref TAS_AM0
+	//! \param progress Optional callback which is called after each received chunk
+	//! \param context User pointer which is passed to progress
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et write_large(uint64_t addr, const void* data, uint32_t num_bytes, uint32_t* num_bytes_ok, uint8_t addr_map = TAS_AM0,
+							  tas_rw_progress_ft progress = nullptr, void* context = nullptr);
 	
 	//! \brief Execute a fill operation with a 32-bit value
 	//! \details addr and num_bytes need to be 32 bit aligned. addr_map has to be lower than TAS_AM12.
@@ -143,6 +280,117 @@ public:
 	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
 	tas_return_et fill64(uint64_t addr, uint64_t value, uint32_t num_bytes, uint8_t addr_map = TAS_AM0);
 
+	//! \brief Execute a fill operation with a repeated byte pattern
+	//! \details addr and num_bytes can have any alignment. The byte at addr + i is pattern[i % pattern_len].
+	//! Parts with a pattern period which divides 8 are filled with FILL transactions if addr_map is lower than TAS_AM12.
+	//! All other parts are written from a single buffer with the replicated pattern. The operation is split into
+	//! pipelined chunks. No further chunks are sent after an error.
+	//! \param addr 64-bit address at which the operation is performed
+	//! \param pattern Pointer to the pattern
+	//! \param pattern_len Length of the pattern in bytes, 1 to 1024
+	//! \param num_bytes Number of bytes to be written
+	//! \param addr_map Address map to be used, default: \ref TAS_AM0
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et fill_pattern(uint64_t addr, const void* pattern, uint32_t pattern_len, uint32_t num_bytes, uint8_t addr_map = TAS_AM0);
+
+	//! \brief Read 8-bit values from a list of addresses
+	//! \details See \ref gather32().
+	//! \param addrs Pointer to a list of 64-bit addresses
+	//! \param values Pointer to a list to which the read values are stored, 0 for failed reads
+	//! \param num Number of addresses
+	//! \param err_bitmap Optional pointer to (num + 63) / 64 words, bit i is set if element i failed
+	//! \param addr_map Address map to be used, default: \ref TAS_AM0
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et gather8(const uint64_t* addrs, uint8_t* values, uint32_t num, uint64_t* err_bitmap = nullptr, uint8_t addr_map = TAS_AM0);
+
+	//! \brief Write 8-bit values to a list of addresses
+	//! \details See \ref gather32().
+	//! \param addrs Pointer to a list of 64-bit addresses
+	//! \param values Pointer to a list of values to be written
+	//! \param num Number of addresses
+	//! \param err_bitmap Optional pointer to (num + 63) / 64 words, bit i is set if element i failed
+	//! \param addr_map Address map to be used, default: \ref TAS_AM0
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et scatter8(const uint64_t* addrs, const uint8_t* values, uint32_t num, uint64_t* err_bitmap = nullptr, uint8_t addr_map = TAS_AM0);
+
+	//! \brief Read 16-bit values from a list of addresses
+	//! \details See \ref gather32().
+	//! \param addrs Pointer to a list of 64-bit addresses
+	//! \param values Pointer to a list to which the read values are stored, 0 for failed reads
+	//! \param num Number of addresses
+	//! \param err_bitmap Optional pointer to (num + 63) / 64 words, bit i is set if element i failed
+	//! \param addr_map Address map to be used, default: \ref TAS_AM0
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et gather16(const uint64_t* addrs, uint16_t* values, uint32_t num, uint64_t* err_bitmap = nullptr, uint8_t addr_map = TAS_AM0);
+
+	//! \brief Write 16-bit values to a list of addresses
+	//! \details See \ref gather32().
+	//! \param addrs Pointer to a list of 64-bit addresses
+	//! \param values Pointer to a list of values to be written
+	//! \param num Number of addresses
+	//! \param err_bitmap Optional pointer to (num + 63) / 64 words, bit i is set if element i failed
+	//! \param addr_map Address map to be used, default: \ref TAS_AM0
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et scatter16(const uint64_t* addrs, const uint16_t* values, uint32_t num, uint64_t* err_bitmap = nullptr, uint8_t addr_map = TAS_AM0);
+
+	//! \brief Read 32-bit values from a list of addresses
+	//! \details The addresses are encoded into an internal transaction list which is reused between calls.
+	//! The list is split into as many PL2 packets and round trips as needed, with two chunks in flight.
+	//! All elements are executed even if some of them fail. Elements after a failed one in the same
+	//! PL1 packet are not executed by the server and are marked as failed as well.
+	//! \param addrs Pointer to a list of 64-bit addresses
+	//! \param values Pointer to a list to which the read values are stored, 0 for failed reads
+	//! \param num Number of addresses
+	//! \param err_bitmap Optional pointer to (num + 63) / 64 words, bit i is set if element i failed
+	//! \param addr_map Address map to be used, default: \ref TAS_AM0
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et gather32(const uint64_t* addrs, uint32_t* values, uint32_t num, uint64_t* err_bitmap = nullptr, uint8_t addr_map = TAS_AM0);
+
+	//! \brief Write 32-bit values to a list of addresses
+	//! \details See \ref gather32().
+	//! \param addrs Pointer to a list of 64-bit addresses
+	//! \param values Pointer to a list of values to be written
+	//! \param num Number of addresses
+	//! \param err_bitmap Optional pointer to (num + 63) / 64 words, bit i is set if element i failed
+	//! \param addr_map Address map to be used, default: \ref TAS_AM0
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et scatter32(const uint64_t* addrs, const uint32_t* values, uint32_t num, uint64_t* err_bitmap = nullptr, uint8_t addr_map = TAS_AM0);
+
+	//! \brief Read 64-bit values from a list of addresses
+	//! \details See \ref gather32().
+	//! \param addrs Pointer to a list of 64-bit addresses
+	//! \param values Pointer to a list to which the read values are stored, 0 for failed reads
+	//! \param num Number of addresses
+	//! \param err_bitmap Optional pointer to (num + 63) / 64 words, bit i is set if element i failed
+	//! \param addr_map Address map to be used, default: \ref TAS_AM0
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et gather64(const uint64_t* addrs, uint64_t* values, uint32_t num, uint64_t* err_bitmap = nullptr, uint8_t addr_map = TAS_AM0);
+
+	//! \brief Write 64-bit values to a list of addresses
+	//! \details See \ref gather32().
+	//! \param addrs Pointer to a list of 64-bit addresses
+	//! \param values Pointer to a list of values to be written
+	//! \param num Number of addresses
+	//! \param err_bitmap Optional pointer to (num + 63) / 64 words, bit i is set if element i failed
+	//! \param addr_map Address map to be used, default: \ref TAS_AM0
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et scatter64(const uint64_t* addrs, const uint64_t* values, uint32_t num, uint64_t* err_bitmap = nullptr, uint8_t addr_map = TAS_AM0);
+
+	//! \brief Execute a batch of 32-bit read-modify-write operations
+	//! \details All registers are read with one transaction list. If all reads succeeded, the new values are written with
+	//! a second one. Entries with the same address are applied in order to the value which was read, and only the
+	//! result is written once at the position of the last entry. With verify each register is read back directly
+	//! after its write and compared in the modified bits.
+	//! Both lists are executed in pipelined chunks like \ref write_large(). When a write error is reported, the next
+	//! chunk can already be sent, so registers after the failed one can be written.
+	//! The batch is not atomic. Registers can change between the read and the write.
+	//! \param rmw Pointer to a list of read-modify-write operations, addr needs to be 32 bit aligned
+	//! \param num_rmw Number of operations in the list
+	//! \param verify If \c true, the written bits are read back and compared
+	//! \param addr_map Address map to be used, default: \ref TAS_AM0
+	//! \returns \ref TAS_ERR_NONE on success, \ref TAS_ERR_RW_WRITE if verify failed, otherwise any other relevant TAS error code
+	tas_return_et rmw_batch32(const tas_rw_rmw32_st* rmw, uint32_t num_rmw, bool verify = false, uint8_t addr_map = TAS_AM0);
+
 	//! \brief Execute a series of read and write operations based on provided transaction list.
 	//! \details Use transaction arrays for higher efficiency and for ensuring atomicity of the execution \n
 	//! If trans contains a mixture of different address maps, the following rules apply: \n
@@ -156,6 +404,64 @@ public:
 	//! \param num_trans Number of transaction in the list
 	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
 	tas_return_et execute_trans(const tas_rw_trans_st* trans, uint32_t num_trans);
+
+	//! \brief Execute a transaction list of any length.
+	//! \details The list is split into chunks which fit into the packet buffers. A chunk is sent while the response
+	//! of the previous chunk is still outstanding. The rules of \ref execute_trans() apply within a chunk.
+	//! All chunks are executed even if a transaction failed. The first error is returned.
+	//! \param trans Pointer to a list of transactions
+	//! \param num_trans Number of transaction in the list
+	//! \param trans_rsp Optional pointer to a list of num_trans responses to trans. Transactions which were not executed
+	//! return \ref TAS_PL_ERR_PROTOCOL
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et execute_trans_unbounded(const tas_rw_trans_st* trans, uint32_t num_trans, tas_rw_trans_rsp_st* trans_rsp = nullptr);
+
+	//! \brief Execute a transaction list in best effort mode
+	//! \details In contrast to \ref execute_trans_unbounded() failed transactions are not reported as error of the call.
+	//! No error info text is formatted for them. Transactions which the server skipped with \ref TAS_PL0_ERR_CONSEQUENTIAL
+	//! after an error in the same PL1 packet are executed again in a following pass. All passes are pipelined.
+	//! A skipped access is not expected to have taken place, so a write is not repeated on the device. This is
+	//! implementation specific for the server.
+	//! A skipped part of a split transaction is resumed after the bytes which were already read or written.
+	//! Read, write and fill transactions above CTasPktHandlerRw::MAX_NUM_BYTES_RW bytes are executed in parts.
+	//! \param trans Pointer to a list of transactions
+	//! \param num_trans Number of transaction in the list
+	//! \param pl_err Optional pointer to a list of num_trans PL error codes, \ref TAS_PL0_ERR_NO_ERROR on success.
+	//! Transactions which were not executed, e.g. after a lost server connection, return \ref TAS_PL_ERR_PROTOCOL
+	//! \param num_bytes_ok Optional pointer to a list of num_trans numbers of successfully read or written bytes
+	//! \param num_failed Optional pointer to the number of failed transactions
+	//! \returns \ref TAS_ERR_NONE if the list was executed, otherwise any other relevant TAS error code
+	tas_return_et execute_trans_best_effort(const tas_rw_trans_st* trans, uint32_t num_trans, tas_pl_err_et8* pl_err = nullptr,
+											uint32_t* num_bytes_ok = nullptr, uint32_t* num_failed = nullptr);
+
+	//! \brief Encode a transaction list once for repeated execution with \ref execute_prepared().
+	//! \details The same rules as for \ref execute_trans() apply. The data buffers referenced by trans have to stay valid
+	//! as long as prepared is used. A previously prepared list in prepared is replaced.
+	//! \param trans Pointer to a list of transactions
+	//! \param num_trans Number of transaction in the list
+	//! \param prepared Pointer to the object which stores the encoded transactions
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et prepare_trans(const tas_rw_trans_st* trans, uint32_t num_trans, CTasPreparedTrans* prepared);
+
+	//! \brief Execute a transaction list which was encoded with \ref prepare_trans().
+	//! \details Only the write payloads and the PL1 counters of the request are updated before sending.
+	//! Use \ref CTasPreparedTrans::get_trans_rsp() for individual error handling.
+	//! \param prepared Pointer to the prepared transaction list
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et execute_prepared(CTasPreparedTrans* prepared);
+
+	//! \brief Compute the packets, round trips and bytes a transaction list needs without sending anything.
+	//! \details The list is encoded with the same packet handler logic and limits as \ref execute_trans().
+	//! Lists which exceed the limits of a single \ref execute_trans() call are split into several round trips.
+	//! Alternative encodings can be compared by calling this method with different options.
+	//! \param trans Pointer to a list of transactions
+	//! \param num_trans Number of transaction in the list
+	//! \param plan Pointer to the computed figures
+	//! \param options Combination of \ref tas_rw_plan_option_et values, default: \ref TAS_RW_PLAN_DEFAULT
+	//! \param span_planner Span read planner with the safe regions, needed for \ref TAS_RW_PLAN_COALESCE. Its last plan is replaced.
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et plan_trans(const tas_rw_trans_st* trans, uint32_t num_trans, tas_rw_plan_st* plan,
+							 uint32_t options = TAS_RW_PLAN_DEFAULT, CTasRwSpanPlanner* span_planner = nullptr);
 	
 
 	// The following methods are only needed for special use cases and debugging
@@ -183,12 +489,39 @@ public:
 	//! \returns 32-bit timeout value
 	uint32_t rw_get_timeout();
 
+	//! \brief Set the memory budget for the packet buffers and transaction lists of this client
+	//! \details Has to be called before the session start. The buffers are sized at session start so that the
+	//! arena and the second packet handler fit into num_bytes. Larger budgets allow more PL2 packets per round trip,
+	//! smaller ones save memory for mostly idle clients. At least one PL2 request and response packet of the maximum
+	//! size of the connection is always allocated, even if this exceeds the budget.
+	//! Responses are received per PL2 packet, so the response buffer only holds one PL2 packet of the connection.
+	//! Default is 0, which sizes the request buffers for up to CTasPktHandlerRw::PKT_BUF_SIZE_DEFAULT bytes.
+	//! Larger buffers allow more transactions per request, but a single read or write transaction is still limited
+	//! to CTasPktHandlerRw::MAX_NUM_BYTES_RW bytes, since tas_rw_trans_rsp_st::num_bytes_ok is 16 bit.
+	//! read_large() and write_large() split larger accesses.
+	//! \param num_bytes Memory budget in bytes, 0 for the default
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et rw_set_mem_budget(size_t num_bytes);
+
+	//! \brief Get the memory which is used for the packet buffers and transaction lists of this client
+	//! \returns the arena size in bytes, 0 if it is not yet allocated. Without the second packet handler
+	//! if it is allocated on first use.
+	size_t rw_get_mem_size() const { return mArenaSize; }
+
+	//! \brief Select tight PL2 packet packing for the transactions of this client
+	//! \details See CTasPktHandlerRw::rw_set_pack_tight(). Tight packing needs fewer PL2 packets and round trips for
+	//! mixed batches and large block transfers. Default is greedy packing.
+	//! \param enable \c true for tight packing, \c false for greedy packing
+	void rw_set_pack_tight(bool enable);
+
 	//! \brief Base class object constructor. !!Only used within the server and for special test setups!!
 	//! \param mb_if Mailbox interface
 	//! \param max_rq_size Defines maximum size of request packets
 	//! \param max_rsp_size Defines maximum size of response packets
 	//! \param max_num_rw Defines maximum number of read/write transactions
-	CTasClientRwBase(CTasPktMailboxIf* mb_if, uint32_t max_rq_size, uint32_t max_rsp_size, uint32_t max_num_rw);
+	//! \param arena Optional caller-supplied memory of get_arena_size(max_rq_size, max_rsp_size, max_num_rw) bytes,
+	//! 8 byte aligned. Allocated internally if nullptr.
+	CTasClientRwBase(CTasPktMailboxIf* mb_if, uint32_t max_rq_size, uint32_t max_rsp_size, uint32_t max_num_rw, void* arena = nullptr);
 
 protected:
 
@@ -198,10 +531,127 @@ protected:
 
 	CTasPktHandlerRw* mTphRw = nullptr; //!< \brief Packet handler object. Used for constructing and parsing packets.
 
+	//! \brief Get the part of the arena which is reserved for a packet handler
+	//! \param index 0 for mTphRw, 1 for the second packet handler of the pipelined execution
+	//! \returns pointer to the memory of the packet handler
+	void* mGetTphArena(uint32_t index) { assert(index < mArenaNumTph); return mArena + ((mRspBufSize + 7) & ~7u) + index * mTphArenaSize; }
+
+	//! \brief Allocate the buffers for a started session if needed and create the packet handler
+	//! \param con_info Pointer to the connection information of the session
+	void mInitSessionBuffers(const tas_con_info_st* con_info);
+
 private:
 	uint32_t mTimeoutMs = TAS_DEFAULT_TIMEOUT_MS;	//!< \brief Current timeout setting.
 
-	std::vector<uint32_t> mRspBuf; //!< \brief Response packet buffer. For one or more PL2 packets.
+	uint8_t*  mArena = nullptr;			//!< \brief Response buffer followed by the memory of the packet handlers
+	uint64_t* mArenaOwned = nullptr;	//!< \brief Internally allocated arena, nullptr if the arena was supplied by the caller
+	size_t    mArenaSize = 0;			//!< \brief Size of the arena in bytes
+	size_t    mTphArenaSize = 0;		//!< \brief Size of the arena part of one packet handler
+	uint32_t  mArenaMaxRqSize = 0;		//!< \brief Maximum request size of the packet handlers in the arena
+	uint32_t  mArenaMaxNumRw = 0;		//!< \brief Maximum number of read/write transactions of the packet handlers in the arena
+	uint32_t  mArenaNumTph = 0;			//!< \brief Number of packet handlers in the arena. 1 if the second one allocates on first use.
+	uint32_t  mTphMaxRspSize = 0;		//!< \brief Maximum response size of the packet handlers. Can exceed mRspBufSize.
+
+	size_t   mMemBudget = 0;			//!< \brief Memory budget for the arena, 0 for the default buffer sizes
+	uint32_t mMaxRspSizeDefault;		//!< \brief Maximum response size of a round trip with the default budget
+	bool     mPackTight = false;		//!< \brief Tight PL2 packet packing for all packet handlers of this client
+
+	uint32_t* mRspBuf = nullptr;	//!< \brief Response packet buffer. For at least one PL2 packet.
+	uint32_t  mRspBufSize = 0;		//!< \brief Size of mRspBuf in bytes
+
+	//! \brief Set up the arena and the response buffer
+	//! \details A caller-supplied arena holds both packet handlers, an internally allocated one only the first.
+	//! \param max_rq_size Maximum size of request packets of the packet handlers
+	//! \param max_rsp_size Size of the response buffer
+	//! \param max_num_rw Maximum number of read/write transactions of the packet handlers
+	//! \param arena Caller-supplied memory or nullptr
+	void mInitArena(uint32_t max_rq_size, uint32_t max_rsp_size, uint32_t max_num_rw, void* arena);
+
+	//! \brief Delete the packet handlers and the internally allocated arena
+	void mReleaseBuffers();
+
+	//! \brief Take over the packet handlers and the buffers of another object
+	//! \param other object which is moved from
+	void mMoveFrom(CTasClientRwBase& other);
+
+	CTasPktHandlerRw* mTphRwPipe = nullptr; //!< \brief Second packet handler for the chunk in flight. Created on first use.
+	CTasPktHandlerRw* mTphRwPlan = nullptr; //!< \brief Packet handler for plan_trans(). Created on first use.
+	std::vector<tas_rw_trans_st> mPlanTrans;	//!< \brief Reused reordered transaction list for plan_trans()
+
+	std::vector<tas_rw_trans_st> mGsTrans;			//!< \brief Reused transaction list for gather/scatter
+	std::vector<tas_rw_trans_rsp_st> mGsTransRsp;	//!< \brief Reused transaction responses for gather/scatter
+
+	//! \brief State of an entry of rmw_batch32()
+	struct tas_rmw32_state_st {
+		uint32_t value;		//!< \brief Read value, the written value for the last entry of an address
+		uint32_t mask;		//!< \brief Modified bits of all entries of the address, only for the last entry
+		uint32_t value_rb;	//!< \brief Value which was read back for verify
+		bool last;			//!< \brief Last entry of the address, which is written
+	};
+	std::vector<tas_rw_trans_st> mRmwTrans;		//!< \brief Reused transaction list for rmw_batch32()
+	std::vector<uint32_t> mRmwIdx;				//!< \brief Reused entry indices of rmw_batch32() sorted by address
+	std::vector<tas_rmw32_state_st> mRmwState;	//!< \brief Reused entry states of rmw_batch32()
+
+	//! \brief Create the second packet handler if needed and update its connection info
+	void mInitTphRwPipe();
+
+	//! \brief Receive and parse the response PL2 packets of a request which was sent with the mailbox send method.
+	//! \details Each packet is parsed while the following ones are still in transit. All packets are received,
+	//! also after a parsing error.
+	//! \param tph Packet handler which built the request
+	//! \param num_pl2_pkt Number of PL2 packets in the request
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et mReceiveParseRsp(CTasPktHandlerRw* tph, uint32_t num_pl2_pkt);
+
+	//! \brief Execute a request which was built by a packet handler and parse the response
+	//! \details Requests with several PL2 packets are received and parsed per packet, so that the response
+	//! buffer only has to hold one PL2 packet.
+	//! \param tph Packet handler which built the request
+	//! \param rq Pointer to the request
+	//! \param num_pl2_pkt Number of PL2 packets in the request
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et mExecuteRq(CTasPktHandlerRw* tph, const uint32_t* rq, uint32_t num_pl2_pkt);
+
+	//! \brief Execute a transaction list in chunks with two chunks in flight
+	//! \param trans Pointer to a list of transactions
+	//! \param num_trans Number of transaction in the list
+	//! \param trans_rsp Optional pointer to a list of num_trans responses to trans
+	//! \param stop_on_error If \c true, no further chunk is sent after a chunk with an error
+	//! \param progress Optional callback which is called after each received chunk
+	//! \param context User pointer which is passed to progress
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et mExecuteTransPipelined(const tas_rw_trans_st* trans, uint32_t num_trans, tas_rw_trans_rsp_st* trans_rsp,
+										 bool stop_on_error, tas_rw_progress_ft progress = nullptr, void* context = nullptr);
+
+	//! \brief Transforms gather/scatter operations into a pipelined transaction list
+	//! \param type \ref TAS_RW_TT_RD or \ref TAS_RW_TT_WR
+	//! \param addrs Pointer to a list of 64-bit addresses
+	//! \param values Pointer to a dense list of values
+	//! \param num_bytes Size of one value in bytes
+	//! \param num Number of addresses
+	//! \param err_bitmap Optional pointer to the error bitmap
+	//! \param addr_map Address map to be used
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et mGatherScatter(tas_rw_trans_type_et type, const uint64_t* addrs, void* values, uint32_t num_bytes, uint32_t num,
+								 uint64_t* err_bitmap, uint8_t addr_map);
+
+	//! \brief Transforms large read/write operations into a pipelined transaction list
+	//! \param type \ref TAS_RW_TT_RD or \ref TAS_RW_TT_WR
+	//! \param addr 64-bit address at which the operation is performed
+	//! \param data Pointer to the data buffer
+	//! \param num_bytes Number of bytes to be read or written
+	//! \param num_bytes_ok Pointer to a variable holding the number of successfully read or written Bytes
+	//! \param addr_map Address map to be used
+	//! \param progress Optional callback which is called after each received chunk
+	//! \param context User pointer which is passed to progress
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et mExecuteLargeTrans(tas_rw_trans_type_et type, uint64_t addr, void* data, uint32_t num_bytes, uint32_t* num_bytes_ok,
+									 uint8_t addr_map, tas_rw_progress_ft progress, void* context);
+
+	//! \brief Get the transaction size for large read/write operations
+	//! \details 4KB, or 1KB if the packet buffers were sized for a small memory budget
+	//! \returns the number of bytes per transaction
+	uint32_t mGetNumBytesPerLargeTrans() const;
 
 	//! \brief Transforms simple read/write operations into single transaction execution
 	//! \param trans Pointer to a transaction definition
@@ -0,0 +1,115 @@
+/*
+ *  Copyright (c) 2024 Infineon Technologies AG.
+ *
+ *  This file is part of TAS Client, an API for device access for Infineon's
+ *  automotive MCUs.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *  **************************************************************************************************************** */
+// TAS includes
+#include "tas_client_rw_pool.h"
+
+// Standard includes
+#include <cassert>
+#include <cstdio>
+#include <algorithm>
+#include <utility>
+
+CTasClientRwPool::CTasClientRwPool(const char* client_name, const char* ip_addr, const char* identifier,
+								   const char* session_name, const char* session_pw, uint16_t port_num)
+	: mClientName(client_name), mIpAddr(ip_addr), mIdentifier(identifier),
+	  mSessionName(session_name), mSessionPw(session_pw), mPortNum(port_num)
+{
+	mErrorInfo[0] = 0;
+}
+
+tas_return_et CTasClientRwPool::mOpen(CTasClientRw* client)
+{
+	tas_return_et ret = client->server_connect(mIpAddr.c_str(), mPortNum);
+	if (ret == TAS_ERR_NONE)
+		ret = client->session_start(mIdentifier.c_str(), mSessionName.c_str(), mSessionPw.c_str());
+	return ret;
+}
+
+tas_return_et CTasClientRwPool::warm_up(uint32_t num_client)
+{
+	while (true) {
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			if (mIdle.size() >= std::min(num_client, mMaxIdle))
+				return TAS_ERR_NONE;
+		}
+
+		// The handshake is done without holding the lock
+		CTasClientRw client(mClientName.c_str());
+		if (tas_return_et ret = mOpen(&client); ret != TAS_ERR_NONE) {
+			std::lock_guard<std::mutex> lock(mMutex);
+			snprintf(mErrorInfo.data(), mErrorInfo.size(), "%s", client.get_error_info());
+			return ret;
+		}
+
+		std::lock_guard<std::mutex> lock(mMutex);
+		if (mIdle.size() >= std::min(num_client, mMaxIdle))
+			return TAS_ERR_NONE;  // Filled by other threads or set_max_idle() was called during the handshake
+		mIdle.push_back(std::move(client));
+	}
+}
+
+tas_return_et CTasClientRwPool::acquire(CTasClientRw* client)
+{
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		while (!mIdle.empty()) {
+			CTasClientRw& idle = mIdle.back();
+			bool active = idle.session_active();  // Probes if the server closed the connection in the meantime
+			if (active)
+				*client = std::move(idle);
+			mIdle.pop_back();
+			if (active)
+				return TAS_ERR_NONE;
+		}
+	}
+
+	*client = CTasClientRw(mClientName.c_str());
+	return mOpen(client);
+}
+
+void CTasClientRwPool::release(CTasClientRw* client)
+{
+	if (!client->session_active())
+		return;
+
+	std::lock_guard<std::mutex> lock(mMutex);
+	if (mIdle.size() < mMaxIdle)
+		mIdle.push_back(std::move(*client));
+}
+
+void CTasClientRwPool::set_max_idle(uint32_t num_client)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	mMaxIdle = num_client;
+	while (mIdle.size() > mMaxIdle)
+		mIdle.pop_back();
+}
+
+std::string CTasClientRwPool::get_error_info() const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return mErrorInfo.data();
+}
+
+uint32_t CTasClientRwPool::get_num_idle() const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return (uint32_t)mIdle.size();
+}
@@ -0,0 +1,116 @@
+/*
+ *  Copyright (c) 2024 Infineon Technologies AG.
+ *
+ *  This file is part of TAS Client, an API for device access for Infineon's
+ *  automotive MCUs.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *  **************************************************************************************************************** */
+
+#pragma once
+
+//! \addtogroup Read_Write_API
+//! \{
+
+// TAS includes
+#include "tas_client_rw.h"
+
+// Standard includes
+#include <array>
+#include <mutex>
+#include <string>
+#include <vector>
+
+//! \brief Pool of read/write clients with started sessions
+//! \details Keeps connected clients warm and hands them out to short jobs, which then skip the
+//! server_connect() and session_start() round trips. All clients of a pool join the same session. \n
+//! Usage: \ref acquire a client, use it, then \ref release it back to the pool. The pool methods can be called
+//! from several threads. A client itself must only be used by one thread at a time.
+class CTasClientRwPool
+{
+
+public:
+	CTasClientRwPool(const CTasClientRwPool&) = delete; //!< \brief delete the copy constructor
+	CTasClientRwPool operator= (const CTasClientRwPool&) = delete; //!< \brief delete copy-assignment operator
+
+	//! \brief Client pool object constructor. No connection is established before \ref warm_up or \ref acquire.
+	//! \param client_name Client name of the pooled clients as a c-string
+	//! \param ip_addr Hostname of a TAS server, can be an IP address or a domain based hostname
+	//! \param identifier Unique access HW name or IP address of device as a c-string
+	//! \param session_name Unique session name as a c-string
+	//! \param session_pw Session password, specify to block other clients joining this session
+	//! \param port_num Server's port number, default: \ref TAS_PORT_NUM_SERVER_DEFAULT
+	CTasClientRwPool(const char* client_name, const char* ip_addr, const char* identifier,
+					 const char* session_name = "", const char* session_pw = "",
+					 uint16_t port_num = TAS_PORT_NUM_SERVER_DEFAULT);
+
+	//! \brief Start sessions until the pool holds a number of idle clients
+	//! \param num_client Number of idle clients, limited to the maximum set by \ref set_max_idle()
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et warm_up(uint32_t num_client);
+
+	//! \brief Hand out a client with a started session
+	//! \details An idle client is moved into client. Idle clients whose connection was closed by the server are
+	//! detected with a non-blocking probe and dropped. If there is none left, a new session is started.
+	//! The previous session of client is ended.
+	//! \param client Pointer to a client object which receives the pooled client. On failure it holds the client
+	//! whose session could not be started, its get_error_info() describes the error.
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et acquire(CTasClientRw* client);
+
+	//! \brief Return a client to the pool
+	//! \details The client is kept if its session is still active and the pool has less than the maximum number
+	//! of idle clients. Otherwise the session ends with the destruction of the client object. The client object
+	//! can only be destroyed or passed to \ref acquire afterwards.
+	//! \param client Pointer to a client which was handed out by \ref acquire
+	void release(CTasClientRw* client);
+
+	//! \brief Set the maximum number of idle clients. Surplus idle clients are released.
+	//! \param num_client Maximum number of idle clients, default: \ref MAX_IDLE_DEFAULT
+	void set_max_idle(uint32_t num_client);
+
+	//! \brief Get the number of idle clients in the pool
+	//! \returns the number of idle clients
+	uint32_t get_num_idle() const;
+
+	//! \brief Get the error information of the last failed \ref warm_up() call
+	//! \returns a copy of the error information, since other threads can update it
+	std::string get_error_info() const;
+
+	//! \brief Pool limits.
+	enum {
+		MAX_IDLE_DEFAULT = 8	//!< \brief Default maximum number of idle clients
+	};
+
+private:
+
+	//! \brief Connect a client to the server and start the session of the pool
+	//! \param client Pointer to a client which is not connected
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et mOpen(CTasClientRw* client);
+
+	std::string mClientName;	//!< \brief Client name of the pooled clients
+	std::string mIpAddr;		//!< \brief Hostname of the TAS server
+	std::string mIdentifier;	//!< \brief Target identifier
+	std::string mSessionName;	//!< \brief Session name
+	std::string mSessionPw;		//!< \brief Session password
+	uint16_t mPortNum;			//!< \brief Server's port number
+
+	mutable std::mutex mMutex;					//!< \brief Protects mIdle, mMaxIdle and mErrorInfo
+	std::vector<CTasClientRw> mIdle;			//!< \brief Idle clients with started sessions
+	uint32_t mMaxIdle = MAX_IDLE_DEFAULT;		//!< \brief Maximum number of idle clients
+
+	std::array<char, TAS_INFO_STR_LEN> mErrorInfo;	//!< \brief Error information of the last failed warm_up()
+};
+
+//! \} // end of group Read_Write_API
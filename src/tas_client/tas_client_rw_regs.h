@@ -0,0 +1,135 @@
+/*
+ *  Copyright (c) 2024 Infineon Technologies AG.
+ *
+ *  This file is part of TAS Client, an API for device access for Infineon's
+ *  automotive MCUs.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *  **************************************************************************************************************** */
+
+#pragma once
+
+//! \addtogroup Read_Write_API
+//! \{
+
+// TAS includes
+#include "tas_client_rw_base.h"
+#include "tas_am15_am14.h"
+
+// Standard includes
+#include <array>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+//! \brief Compile-time register descriptor
+//! \details Declare registers as constexpr objects, e.g. \n
+//! constexpr tas_reg_st<uint32_t, 0xF0000640> SCU_CHIPID; \n
+//! Width, alignment and address map rules are checked at compile time.
+//! \tparam T Register value type with a size of 1, 2, 4 or 8 bytes
+//! \tparam ADDR 64-bit address of the register
+//! \tparam ADDR_MAP Address map to be used, default: \ref TAS_AM0
+//! \tparam ACC_MODE Access mode to be used, default: 0
+template <typename T, uint64_t ADDR, uint8_t ADDR_MAP = TAS_AM0, uint16_t ACC_MODE = 0>
+struct tas_reg_st {
+	static_assert(std::is_trivially_copyable<T>::value, "Register type has to be trivially copyable");
+	static_assert((sizeof(T) == 1) || (sizeof(T) == 2) || (sizeof(T) == 4) || (sizeof(T) == 8), "Register width has to be 1, 2, 4 or 8 bytes");
+	static_assert(ADDR % sizeof(T) == 0, "Register address has to be naturally aligned");
+	static_assert((ADDR_MAP <= TAS_AM15) || (ADDR_MAP == TAS_AM132), "Invalid address map");
+	static_assert((ADDR_MAP < TAS_AM12) || (ADDR < 0x100000000), "Only 32 bit addresses allowed for address maps >= TAS_AM12");
+
+	typedef T value_type;	//!< \brief Register value type
+
+	static constexpr uint64_t addr = ADDR;				//!< \brief 64-bit address of the register
+	static constexpr uint32_t num_bytes = sizeof(T);	//!< \brief Register width in bytes
+	static constexpr uint8_t  addr_map = ADDR_MAP;		//!< \brief Address map
+	static constexpr uint16_t acc_mode = ACC_MODE;		//!< \brief Access mode
+};
+
+//! \brief Typed register access on top of a read/write client
+//! \details Header-only. Each call is executed with a single \ref CTasClientRwBase::execute_trans() round trip.
+class CTasClientRwRegs
+{
+public:
+	CTasClientRwRegs(const CTasClientRwRegs&) = delete; //!< \brief delete the copy constructor
+	CTasClientRwRegs operator= (const CTasClientRwRegs&) = delete; //!< \brief delete copy-assignment operator
+
+	//! \brief Typed register access object constructor
+	//! \param client Pointer to a read/write client with a started session
+	explicit CTasClientRwRegs(CTasClientRwBase* client) : mClient(client) {}
+
+	//! \brief Read a set of registers in one round trip
+	//! \details The values of registers which could not be read are 0.
+	//! \param values Pointer to a tuple which receives the register values in the order of regs
+	//! \param regs Register descriptors
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	template <typename... REG>
+	tas_return_et read_regs(std::tuple<typename REG::value_type...>* values, REG... /* regs */)
+	{
+		static_assert(sizeof...(REG) > 0, "At least one register is needed");
+		return mReadRegs<REG...>(values, std::index_sequence_for<REG...>{});
+	}
+
+	//! \brief Read a set of registers in one round trip
+	//! \details The return value of the execution can be obtained with \ref get_last_ret().
+	//! \param regs Register descriptors
+	//! \returns a tuple with the register values in the order of regs, values of failed reads are 0
+	template <typename... REG>
+	std::tuple<typename REG::value_type...> read_regs(REG... regs)
+	{
+		std::tuple<typename REG::value_type...> values;
+		mLastRet = read_regs(&values, regs...);
+		return values;
+	}
+
+	//! \brief Write a set of registers in one round trip
+	//! \param values Tuple with the register values in the order of regs
+	//! \param regs Register descriptors
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	template <typename... REG>
+	tas_return_et write_regs(const std::tuple<typename REG::value_type...>& values, REG... /* regs */)
+	{
+		static_assert(sizeof...(REG) > 0, "At least one register is needed");
+		return mWriteRegs<REG...>(values, std::index_sequence_for<REG...>{});
+	}
+
+	//! \brief Get the return value of the last \ref read_regs() call which returned a tuple
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et get_last_ret() const { return mLastRet; }
+
+private:
+
+	template <typename... REG, size_t... I>
+	tas_return_et mReadRegs(std::tuple<typename REG::value_type...>* values, std::index_sequence<I...>)
+	{
+		*values = {};  // Default in case of errors
+		std::array<tas_rw_trans_st, sizeof...(REG)> trans = {{
+			{ REG::addr, REG::num_bytes, REG::acc_mode, REG::addr_map, TAS_RW_TT_RD, &std::get<I>(*values) }...
+		}};
+		return mClient->execute_trans(trans.data(), (uint32_t)trans.size());
+	}
+
+	template <typename... REG, size_t... I>
+	tas_return_et mWriteRegs(const std::tuple<typename REG::value_type...>& values, std::index_sequence<I...>)
+	{
+		std::array<tas_rw_trans_st, sizeof...(REG)> trans = {{
+			{ REG::addr, REG::num_bytes, REG::acc_mode, REG::addr_map, TAS_RW_TT_WR, &std::get<I>(values) }...
+		}};
+		return mClient->execute_trans(trans.data(), (uint32_t)trans.size());
+	}
+
+	CTasClientRwBase* mClient;				//!< \brief Client which executes the transactions
+	tas_return_et mLastRet = TAS_ERR_NONE;	//!< \brief Return value of the last read_regs() call which returned a tuple
+};
+
+//! \} // end of group Read_Write_API
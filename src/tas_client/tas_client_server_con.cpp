@@ -25,6 +25,7 @@
 #include <cassert>
 #include <cstdio>
 #include <memory>
+#include <utility>
 #include <array>
 
 CTasClientServerCon::CTasClientServerCon(const char* client_name, tas_error_info_st* ei, CTasPktMailboxIf* mb_if)
@@ -33,7 +34,7 @@ CTasClientServerCon::CTasClientServerCon(const char* client_name, tas_error_info
 {
 	snprintf(mClientName.data(), mClientName.size(), "%s", client_name);
 
-	if (mb_if) { // Only for special test setups
+	if (mb_if) { // Special test setups or a connection which is shared with other clients
 		mMbIf = mb_if;
 	}
 	else {
@@ -53,6 +54,49 @@ CTasClientServerCon::CTasClientServerCon(const char* client_name, tas_error_info
 	mSessionStarted = false;
 }
 
+CTasClientServerCon::CTasClientServerCon(CTasClientServerCon&& other, tas_error_info_st* ei) noexcept
+	: mTphsc(std::move(other.mTphsc)),
+	  mEip(ei)
+{
+	mMoveFrom(other);
+}
+
+CTasClientServerCon& CTasClientServerCon::operator= (CTasClientServerCon&& other) noexcept
+{
+	if (this != &other) {
+		delete mMbSocket;
+		mTphsc = std::move(other.mTphsc);
+		mMoveFrom(other);
+	}
+	return *this;
+}
+
+void CTasClientServerCon::mMoveFrom(CTasClientServerCon& other)
+{
+	mTphsc.set_error_info(mEip);  // Error info of the client object which owns this one
+
+	mMbIf = other.mMbIf;
+	mMbSocket = other.mMbSocket;
+	other.mMbIf = nullptr;
+	other.mMbSocket = nullptr;
+
+	mSessionStarted = other.mSessionStarted;
+	mRcvChlActive = other.mRcvChlActive;
+	mDeviceResetCount = other.mDeviceResetCount;
+	other.mSessionStarted = false;
+
+	mClientName = other.mClientName;
+	mUserName = other.mUserName;
+	mClientPid = other.mClientPid;
+
+	mConnectTimeoutMs = other.mConnectTimeoutMs;
+	mServerIpAddr = other.mServerIpAddr;
+	mServerPortNum = other.mServerPortNum;
+	mServerInfo = (other.mServerInfo) ? mTphsc.get_server_info() : nullptr;  // Points into the moved packet handler
+	mServerChallenge = other.mServerChallenge;
+	other.mServerInfo = nullptr;
+}
+
 CTasClientServerCon::~CTasClientServerCon()
 {
 	delete mMbSocket;
@@ -72,6 +116,34 @@ tas_return_et CTasClientServerCon::server_connect(const char* ip_addr, uint16_t
 	mServerPortNum = 0;
 	mServerChallenge = 0;
 
+	if (tas_return_et ret = mConnectSocket(ip_addr, port_num); ret != TAS_ERR_NONE)
+		return ret;
+
+	const uint32_t *pktRq = mTphsc.get_pkt_rq_server_connect(mClientName.data(), mUserName.data(), mClientPid);
+
+	std::array<uint32_t, (4 + sizeof(tas_pl1rsp_server_connect_st)) / 4> pktRsp;
+	if (!mMbIf->execute(pktRq, pktRsp.data()))
+		return tas_client_handle_error_server_con(mEip);
+
+	if (mTphsc.set_pkt_rsp_server_connect(pktRsp.data(), &mServerInfo, &mServerChallenge)) {
+		return mEip->tas_err;
+	}
+
+	assert(strlen(ip_addr) < IP_ADDR_NAME_BUF_SIZE);
+	snprintf(mServerIpAddr.data(), IP_ADDR_NAME_BUF_SIZE, "%s", ip_addr);
+	mServerPortNum = port_num;
+
+	return tas_clear_error_info(mEip);
+}
+
+tas_return_et CTasClientServerCon::mConnectSocket(const char* ip_addr, uint16_t port_num)
+{
+	if (mMbSocket == nullptr) {  // Mailbox of a connection which is shared with other clients, e.g. CTasPktMailboxMux
+		if (!mMbIf->connected())
+			return mHandleErrorServerConnect(ip_addr, port_num);
+		return TAS_ERR_NONE;
+	}
+
 	bool tasServerConnected = false;
 	
 #ifdef _WIN32
@@ -79,7 +151,7 @@ tas_return_et CTasClientServerCon::server_connect(const char* ip_addr, uint16_t
 		tasutil_start_local_tas_server();
 		int numTries = 0;
 		for (numTries = 0; numTries < 10; numTries++) {
-			if (mMbSocket->server_connect(ip_addr, port_num)) {
+			if (mMbSocket->server_connect(ip_addr, port_num, mConnectTimeoutMs)) {
 				tasServerConnected = true;
 				break;
 			}
@@ -94,26 +166,12 @@ tas_return_et CTasClientServerCon::server_connect(const char* ip_addr, uint16_t
 	}
 #endif
 
-	if (!tasServerConnected && !mMbSocket->server_connect(ip_addr, port_num)) {
+	if (!tasServerConnected && !mMbSocket->server_connect(ip_addr, port_num, mConnectTimeoutMs)) {
 		return mHandleErrorServerConnect(ip_addr, port_num);		
 	}
 	assert(mMbIf == mMbSocket);
 
-	const uint32_t *pktRq = mTphsc.get_pkt_rq_server_connect(mClientName.data(), mUserName.data(), mClientPid);
-
-	std::array<uint32_t, (4 + sizeof(tas_pl1rsp_server_connect_st)) / 4> pktRsp;
-	if (!mMbIf->execute(pktRq, pktRsp.data()))
-		return tas_client_handle_error_server_con(mEip);
-
-	if (mTphsc.set_pkt_rsp_server_connect(pktRsp.data(), &mServerInfo, &mServerChallenge)) {
-		return mEip->tas_err;
-	}
-
-	assert(strlen(ip_addr) < IP_ADDR_NAME_BUF_SIZE);
-	snprintf(mServerIpAddr.data(), IP_ADDR_NAME_BUF_SIZE, "%s", ip_addr);
-	mServerPortNum = port_num;
-
-	return tas_clear_error_info(mEip);
+	return TAS_ERR_NONE;
 }
 
 tas_return_et CTasClientServerCon::server_unlock(const void* key, uint16_t key_length)
@@ -136,22 +194,17 @@ tas_return_et CTasClientServerCon::server_unlock(const void* key, uint16_t key_l
 
 tas_return_et CTasClientServerCon::get_targets(const tas_target_info_st** target_info, uint32_t* num_target)
 {
+	*target_info = nullptr;
 	*num_target = 0;
 
-	if (mRcvChlActive)
-		return mHandleErrorRcvChlActive();
-
-	std::array<uint32_t, TAS_MAX_PKT_SIZE_1KB / 4> pktRsp;
-	uint8_t numTarget;
-	uint8_t numNow;
-	uint8_t startIndex = 0;
+	const tas_target_info_st* targetInfoPage;
+	uint32_t numNow;
+	uint32_t numTarget;
+	uint32_t startIndex = 0;
 
 	do {
-		if (const uint32_t* pktRq = mTphsc.get_pkt_rq_get_targets(startIndex); !mMbIf->execute(pktRq, pktRsp.data()))
-			return tas_client_handle_error_server_con(mEip);
-
-		if (mTphsc.set_pkt_rsp_get_targets(pktRsp.data(), &numTarget, &numNow))
-			return mEip->tas_err;
+		if (tas_return_et ret = get_targets_page((uint8_t)startIndex, &targetInfoPage, &numNow, &numTarget); ret != TAS_ERR_NONE)
+			return ret;
 
 		startIndex += numNow;
 	} 
@@ -163,6 +216,33 @@ tas_return_et CTasClientServerCon::get_targets(const tas_target_info_st** target
 	return tas_clear_error_info(mEip);
 }
 
+tas_return_et CTasClientServerCon::get_targets_page(uint8_t start_index, const tas_target_info_st** target_info,
+													 uint32_t* num_now, uint32_t* num_target)
+{
+	*target_info = nullptr;
+	*num_now = 0;
+	*num_target = 0;
+
+	if (mRcvChlActive)
+		return mHandleErrorRcvChlActive();
+
+	std::array<uint32_t, TAS_MAX_PKT_SIZE_1KB / 4> pktRsp;
+	uint8_t numTarget;
+	uint8_t numNow;
+
+	if (const uint32_t* pktRq = mTphsc.get_pkt_rq_get_targets(start_index); !mMbIf->execute(pktRq, pktRsp.data()))
+		return tas_client_handle_error_server_con(mEip);
+
+	if (mTphsc.set_pkt_rsp_get_targets(pktRsp.data(), &numTarget, &numNow))
+		return mEip->tas_err;
+
+	*target_info = mTphsc.get_target_info_page();
+	*num_now = numNow;
+	*num_target = numTarget;
+
+	return tas_clear_error_info(mEip);
+}
+
 tas_return_et CTasClientServerCon::get_target_clients(
 	const char* identifier,
 	const char** session_name, uint64_t* session_start_time_us,
@@ -174,20 +254,15 @@ tas_return_et CTasClientServerCon::get_target_clients(
 	*target_client_info = nullptr;
 	*num_client = 0;
 
-	if (mRcvChlActive)
-		return mHandleErrorRcvChlActive();
-	
-	std::array<uint32_t, TAS_MAX_PKT_SIZE_1KB / 4> pktRsp;
-	uint8_t numClient;
-	uint8_t numNow;
-	uint8_t startIndex = 0;
+	const tas_target_client_info_st* clientInfoPage;
+	uint32_t numNow;
+	uint32_t numClient;
+	uint32_t startIndex = 0;
 
 	do {
-		if (const uint32_t *pktRq = mTphsc.get_pkt_rq_get_target_clients(identifier, startIndex); !mMbIf->execute(pktRq, pktRsp.data()))
-			return tas_client_handle_error_server_con(mEip);
-
-		if (mTphsc.set_pkt_rsp_get_target_clients(pktRsp.data(), &numClient, &numNow))
-			return mEip->tas_err;
+		if (tas_return_et ret = get_target_clients_page(identifier, (uint8_t)startIndex, session_name, session_start_time_us,
+														&clientInfoPage, &numNow, &numClient); ret != TAS_ERR_NONE)
+			return ret;
 
 		startIndex += numNow;
 	} while (startIndex < numClient);
@@ -198,6 +273,37 @@ tas_return_et CTasClientServerCon::get_target_clients(
 	return tas_clear_error_info(mEip);
 }
 
+tas_return_et CTasClientServerCon::get_target_clients_page(const char* identifier, uint8_t start_index,
+															const char** session_name, uint64_t* session_start_time_us,
+															const tas_target_client_info_st** target_client_info,
+															uint32_t* num_now, uint32_t* num_client)
+{
+	*session_name = "";
+	*session_start_time_us = 0;
+	*target_client_info = nullptr;
+	*num_now = 0;
+	*num_client = 0;
+
+	if (mRcvChlActive)
+		return mHandleErrorRcvChlActive();
+
+	std::array<uint32_t, TAS_MAX_PKT_SIZE_1KB / 4> pktRsp;
+	uint8_t numClient;
+	uint8_t numNow;
+
+	if (const uint32_t *pktRq = mTphsc.get_pkt_rq_get_target_clients(identifier, start_index); !mMbIf->execute(pktRq, pktRsp.data()))
+		return tas_client_handle_error_server_con(mEip);
+
+	if (mTphsc.set_pkt_rsp_get_target_clients(pktRsp.data(), &numClient, &numNow))
+		return mEip->tas_err;
+
+	*target_client_info = mTphsc.get_target_clients_info_page(session_name, session_start_time_us);
+	*num_now = numNow;
+	*num_client = numClient;
+
+	return tas_clear_error_info(mEip);
+}
+
 tas_return_et CTasClientServerCon::mSessionStart(tas_client_type_et client_type, const char* identifier, const char* session_name, const char* session_pw,
 												 tas_chl_target_et chl_target, uint64_t chl_param)
 {
@@ -227,6 +333,87 @@ tas_return_et CTasClientServerCon::mSessionStart(tas_client_type_et client_type,
 	return tas_clear_error_info(mEip);
 }
 
+tas_return_et CTasClientServerCon::mOpenSession(tas_client_type_et client_type, const char* ip_addr, uint16_t port_num,
+												 const char* identifier, const char* session_name, const char* session_pw,
+												 tas_clnt_dco_et dco, uint32_t* ping_rsp)
+{
+	if ((mServerIpAddr[0] != '\0') || mSessionStarted) {
+		assert(false);
+		snprintf(mEip->info, TAS_INFO_STR_LEN, "ERROR: Already connected to server");
+		mEip->tas_err = TAS_ERR_FN_USAGE;
+		return mEip->tas_err;
+	}
+
+	mServerInfo = nullptr;
+	mServerChallenge = 0;
+	mDeviceResetCount = ~0;
+
+	if (tas_return_et ret = mConnectSocket(ip_addr, port_num); ret != TAS_ERR_NONE)
+		return ret;
+
+	// All requests are sent before the first response is awaited. The server processes them in order.
+	// The request buffer of mTphsc can be reused as soon as a request was sent.
+	enum { RQ_SERVER_CONNECT, RQ_SESSION_START, RQ_DEVICE_CONNECT, RQ_PING };
+	const uint32_t numRq = (ping_rsp) ? RQ_PING + 1 : RQ_DEVICE_CONNECT + 1;
+	for (uint32_t r = 0; r < numRq; r++) {
+		const uint32_t* pktRq = nullptr;
+		switch (r) {
+		case RQ_SERVER_CONNECT: pktRq = mTphsc.get_pkt_rq_server_connect(mClientName.data(), mUserName.data(), mClientPid); break;
+		case RQ_SESSION_START:  pktRq = mTphsc.get_pkt_rq_session_start(client_type, identifier, session_name, session_pw, TAS_CHL_TGT_UNKNOWN, 0); break;
+		case RQ_DEVICE_CONNECT: pktRq = mTphsc.get_pkt_rq_device_connect(dco); break;
+		case RQ_PING:           pktRq = mTphsc.get_pkt_rq_ping(TAS_PL1_CMD_PING); break;
+		default: assert(false);
+		}
+		if (!mMbIf->send(pktRq, 1))
+			return tas_client_handle_error_server_con(mEip);
+	}
+
+	// All responses are received to keep the connection in sync, only the first error is reported
+	tas_return_et ret = TAS_ERR_NONE;
+	std::array<uint32_t, TAS_MAX_PKT_SIZE_1KB / 4> pktRsp;
+	for (uint32_t r = 0; r < numRq; r++) {
+		uint32_t* rsp = (r == RQ_PING) ? ping_rsp : pktRsp.data();
+		if (uint32_t numBytes; !mMbIf->receive(rsp, &numBytes))
+			return tas_client_handle_error_server_con(mEip);
+		if (ret != TAS_ERR_NONE)
+			continue;
+
+		switch (r) {
+		case RQ_SERVER_CONNECT:
+			if (mTphsc.set_pkt_rsp_server_connect(rsp, &mServerInfo, &mServerChallenge)) {
+				ret = mEip->tas_err;
+				break;
+			}
+			assert(strlen(ip_addr) < IP_ADDR_NAME_BUF_SIZE);
+			snprintf(mServerIpAddr.data(), IP_ADDR_NAME_BUF_SIZE, "%s", ip_addr);
+			mServerPortNum = port_num;
+			break;
+		case RQ_SESSION_START:
+			if (mTphsc.set_pkt_rsp_session_start(client_type, rsp)) {
+				ret = mEip->tas_err;
+				break;
+			}
+			mSessionStarted = true;
+			break;
+		case RQ_DEVICE_CONNECT: {
+			uint16_t devConFeatUsed;
+			if (uint32_t deviceType; mTphsc.set_pkt_rsp_device_connect(rsp, &devConFeatUsed, &deviceType)) {
+				ret = mEip->tas_err;
+				break;
+			}
+			assert(devConFeatUsed == dco);
+			break;
+		}
+		default:
+			break;  // The ping response is parsed by the derived class
+		}
+	}
+	if (ret != TAS_ERR_NONE)
+		return ret;
+
+	return tas_clear_error_info(mEip);
+}
+
 tas_return_et CTasClientServerCon::device_unlock_get_challenge(tas_dev_unlock_cr_option_et ulcro, const void** challenge, uint16_t* challenge_length)
 {
 	*challenge = nullptr;
@@ -44,7 +44,7 @@ public:
 
 	//! \brief Get current error information string
 	//! \returns pointer to a c-string containing current error information.
-	const char* get_error_info() const { return mEip->info; }
+	const char* get_error_info() const { return tas_get_error_info(mEip); }
 	
 	//! \brief Establishes a connection to a TAS server.
 	//! \details In case of \ref TAS_ERR_SERVER_LOCKED use \ref server_unlock() and optional \ref get_server_challenge() before.
@@ -86,6 +86,20 @@ public:
 	//! \param num_target pointer to a number of targets in the list
 	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code 
 	tas_return_et get_targets(const tas_target_info_st** target_info, uint32_t* num_target);
+
+	//! \brief Get one page of the list of targets connected to a server.
+	//! \details Allows to process the targets while the list is paged instead of after the last page.
+	//! The server samples its list when start_index is 0. Continue with start_index increased by num_now
+	//! until it reaches num_target: \n
+	//! for (uint32_t i = 0; i < numTarget; i += numNow) get_targets_page((uint8_t)i, &ti, &numNow, &numTarget); \n
+	//! The protocol limits the list to 255 targets.
+	//! \param start_index index of the first target of the page
+	//! \param target_info pointer to the targets of the page, valid until the next list request
+	//! \param num_now pointer to the number of targets in the page
+	//! \param num_target pointer to the number of targets in the list
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et get_targets_page(uint8_t start_index, const tas_target_info_st** target_info,
+								   uint32_t* num_now, uint32_t* num_target);
 	
 	//! \brief Get a list of clients connected to a target.
 	//! \details The target_client_info array lists all clients that are connected to the target selected by identifier.
@@ -111,11 +125,33 @@ public:
 									 uint64_t* session_start_time_us,
 		                             const tas_target_client_info_st** target_client_info, 
 									 uint32_t* num_client);
+
+	//! \brief Get one page of the list of clients connected to a target.
+	//! \details Paging works like \ref get_targets_page(). The session name and start time are received with
+	//! the page at start_index 0. In contrast to \ref get_target_clients() the clients are not sorted by their
+	//! connect time. The protocol limits the list to 255 clients.
+	//! \param identifier Pointer to a c-string containing target's identifier
+	//! \param start_index index of the first client of the page
+	//! \param session_name Pointer to a session name of a running session
+	//! \param session_start_time_us Pointer to a start time of the running session
+	//! \param target_client_info Pointer to the clients of the page, valid until the next list request
+	//! \param num_now Pointer to the number of clients in the page
+	//! \param num_client Pointer to the number of clients in the list
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et get_target_clients_page(const char* identifier, uint8_t start_index,
+										  const char** session_name, uint64_t* session_start_time_us,
+										  const tas_target_client_info_st** target_client_info,
+										  uint32_t* num_now, uint32_t* num_client);
 	
 	//! \brief Get connection information of an established connection.
 	//! \returns pointer to the connection information
 	const tas_con_info_st* get_con_info() const { return mTphsc.get_con_info(); }
 
+	//! \brief Check if the session is started and the server connection is still established.
+	//! \details The connection is probed without blocking. Must only be called when no response is outstanding.
+	//! \returns \c true if the client can be used for device accesses, otherwise \c false
+	bool session_active() const { return mSessionStarted && mMbIf && mMbIf->connected_idle(); }
+
 	//! \brief Get a challenge for device unlocking.
 	//! \param ulcro select device specific challenge response sequence options
 	//! \param challenge pointer to a challenge
@@ -153,6 +189,19 @@ protected:
 	//! \param ei pointer to an error info
 	//! \param mb_if respective mailbox interface
 	CTasClientServerCon(const char* client_name, tas_error_info_st* ei, CTasPktMailboxIf* mb_if = nullptr);
+
+	//! \brief Client-Server connection move constructor. Called by the move constructor of the respective client object.
+	//! \details The server connection and the session are taken over. The moved-from object can only be destroyed
+	//! or assigned to.
+	//! \param other client-server connection object which is moved from
+	//! \param ei pointer to the error info of the new client object
+	CTasClientServerCon(CTasClientServerCon&& other, tas_error_info_st* ei) noexcept;
+
+	//! \brief Client-Server connection move-assignment operator. Called by the respective client object.
+	//! \details The own server connection is closed before the connection of other is taken over.
+	//! \param other client-server connection object which is moved from
+	//! \returns reference to this object
+	CTasClientServerCon& operator= (CTasClientServerCon&& other) noexcept;
 	
 	//! \brief Start a session.
 	//! \param client_type specifies the type of a client, RW, CHL, or TRC
@@ -171,6 +220,24 @@ protected:
 	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
 	tas_return_et mDeviceConnect(tas_clnt_dco_et dco);
 
+	//! \brief Connect to a server, start a session and connect to the device with pipelined requests.
+	//! \details The server connect, session start, device connect and optional ping requests are sent back to back
+	//! and the responses are received afterwards. Together with the socket connection this needs two round trips
+	//! instead of five. If a request fails, the following ones fail as well and the first error is returned.
+	//! \param client_type specifies the type of a client, RW or TRC
+	//! \param ip_addr Hostname of a TAS server, can be an IP address or a domain based hostname
+	//! \param port_num Server's port number
+	//! \param identifier Unique access HW name or IP address of device as a c-string
+	//! \param session_name pointer to a c-string containing the session's name
+	//! \param session_pw pointer to a c-string containing the session's password
+	//! \param dco connect option, connect to a device with hot attach, reset, or reset and halt
+	//! \param ping_rsp optional buffer of \ref TAS_MAX_PKT_SIZE_1KB bytes for the unparsed ping response.
+	//! No ping is sent if nullptr.
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et mOpenSession(tas_client_type_et client_type, const char* ip_addr, uint16_t port_num,
+							   const char* identifier, const char* session_name, const char* session_pw,
+							   tas_clnt_dco_et dco, uint32_t* ping_rsp);
+
 	CTasPktMailboxIf* mMbIf = nullptr;	//!< \brief Mailbox interface.
 
 	CTasPktMailboxSocket* mMbSocket = nullptr;	//!< \brief Mailbox interface with a socket connection.
@@ -181,6 +248,8 @@ protected:
 
 	uint32_t mDeviceResetCount = ~0;	//!< \brief device reset counter
 
+	int mConnectTimeoutMs = -1;		//!< \brief Timeout of the socket connection to a server, -1 blocks
+
 private:
 
 	//! \brief Handle a failed attempt to connect to a server. 
@@ -189,10 +258,20 @@ private:
 	//! \returns \ref TAS_ERR_SERVER_CON
 	tas_return_et mHandleErrorServerConnect(const char* ip_addr, uint16_t port_num);
 
+	//! \brief Establish the socket connection to a server. Starts a local server on Windows if needed.
+	//! \param ip_addr pointer to a c-string containing server's hostname
+	//! \param port_num server's port number
+	//! \returns \ref TAS_ERR_NONE on success, otherwise \ref TAS_ERR_SERVER_CON
+	tas_return_et mConnectSocket(const char* ip_addr, uint16_t port_num);
+
 	//! \brief Handle wrong usages of receive and bi-directional channels.
 	//! \returns \ref TAS_ERR_FN_USAGE
 	tas_return_et mHandleErrorRcvChlActive();
 
+	//! \brief Take over the connection and the session of another object. mTphsc was already moved.
+	//! \param other client-server connection object which is moved from
+	void mMoveFrom(CTasClientServerCon& other);
+
 	std::array<char, TAS_NAME_LEN32> mClientName;  	//!< \brief Client name as in \ref tas_pl1rq_server_connect_st
 	
 	std::array<char, TAS_NAME_LEN16> mUserName;		//!< \brief Name of the user, who created this client
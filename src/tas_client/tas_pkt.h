@@ -52,6 +52,13 @@ typedef enum {
 	TAS_PKT_PROTOC_VER_1 = 1,  //!< \brief Initial protocol version (value 0 is unknown/undefined/unused etc.)
 } tas_protoc_ver_et;
 
+//! \brief Definition of optional server features.
+//! \details Used in \ref tas_server_info_st .supp_feat. Older servers set the field to 0.
+//! \ingroup Protocol_Definition
+typedef enum {
+	TAS_SERVER_FEAT_CON_ID_SESSION = 0,  //!< \brief Separate session for each con_id of a connection. The con_id of the requests is echoed.
+} tas_server_feat_et;
+
 //! \brief Collection of used port numbers.
 //! \details Non-standard port numbers are used. Current list can be found at https://en.wikipedia.org/wiki/List_of_TCP_and_UDP_port_numbers.
 //! \ingroup Protocol_Definition
@@ -295,7 +302,8 @@ typedef struct {
 	uint32_t  supp_protoc_ver;  //!< \brief Supported protocol versions.  tas_protoc_ver_et defines the bit number
 	uint32_t  supp_chl_target;  //!< \brief Supported channel targets.    tas_chl_target_et defines the bit number
 	uint32_t  supp_trc_type;    //!< \brief Supported trace stream types. tas_trc_type_et   defines the bit number
-	uint32_t  reserved[4];		//!< \brief Reserved field: 0
+	uint32_t  supp_feat;        //!< \brief Supported optional features.  tas_server_feat_et defines the bit number
+	uint32_t  reserved[3];		//!< \brief Reserved field: 0
 	char      date[16];         //!< \brief String from __DATE__ macro at compile time
 	uint64_t  start_time_us;    //!< \brief Time the server was started, as microseconds elapsed since midnight, January 1, 1970
 } tas_server_info_st;
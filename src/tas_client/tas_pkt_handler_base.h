@@ -56,6 +56,14 @@ public:
 	//! \brief Base class destructor
 	virtual ~CTasPktHandlerBase() = default;
 
+	CTasPktHandlerBase(CTasPktHandlerBase&&) = default; //!< \brief default move constructor, see \ref set_error_info()
+	CTasPktHandlerBase& operator= (CTasPktHandlerBase&&) = default; //!< \brief default move-assignment operator
+
+	//! \brief Set the TAS error info
+	//! \details A moved packet handler keeps the error info of its previous owner. The new owner has to set its own.
+	//! \param ei pointer to the TAS error info
+	void set_error_info(tas_error_info_st* ei) { mEip = ei; }
+
 	//! \brief Get a ping request packet 
 	//! \param cmd command identifier, \ref TAS_PL1_CMD_PING
 	//! \returns pointer to the generated request packet
@@ -107,6 +115,7 @@ protected:
 
 	// This needs to be allocated and set in the derived class:
 	uint32_t* mRqBuf;  //!< \brief pointer to a request buffer. For one or more PL2 packet. Allocated and set in a derived class.
+	std::unique_ptr<uint32_t[]> mRqBufOwned;  //!< \brief request buffer if allocated with new by a derived class. Keeps mRqBuf valid when moved.
 	uint32_t mMaxRqSize; //!< \brief maximum request sizes in bytes. Can be more than one PL2 packet. Allocated and set in a derived class.
 	uint32_t mMaxRspSize; //!< \brief maximum response sizes in bytes. Can be more than one PL2 packet. Allocated and set in a derived class.
 	uint32_t mRqWiMax;	//!< \brief maximum value of the (word) index in the request buffer
@@ -30,18 +30,14 @@ CTasPktHandlerChl::CTasPktHandlerChl(tas_error_info_st* ei)
 {
 	// From CTasPktHandlerBase, allocated and set here in the derived class:
 	mMaxRqSize = TAS_PL1_CHL_MAX_MSG_SIZE + 64;
-	mRqBuf = new uint32_t[mMaxRqSize / 4];
+	mRqBufOwned.reset(new uint32_t[mMaxRqSize / 4]);
+	mRqBuf = mRqBufOwned.get();
 	mRqWiMax = mMaxRqSize / 4;
 	mMaxRspSize = mMaxRqSize;
 
 	mDeviceResetCount = 0;
 }
 
-CTasPktHandlerChl::~CTasPktHandlerChl()
-{
-	delete[] mRqBuf;
-}
-
 const uint32_t* CTasPktHandlerChl::get_pkt_rq_subscribe(uint8_t chl, tas_cht_et cht, tas_chso_et chso, uint8_t prio)
 {
 	assert(chl < TAS_CHL_NUM_MAX);
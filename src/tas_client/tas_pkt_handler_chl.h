@@ -37,8 +37,8 @@ public:
 	//! \param ei pointer to the TAS error info 
 	explicit CTasPktHandlerChl(tas_error_info_st* ei);
 
-	//! \brief Packet handler object destructor for cleanup 
-	~CTasPktHandlerChl();
+	CTasPktHandlerChl(CTasPktHandlerChl&&) = default; //!< \brief default move constructor
+	CTasPktHandlerChl& operator= (CTasPktHandlerChl&&) = default; //!< \brief default move-assignment operator
 
 	//! \brief Get a request packet for subscribing to a channel.
 	//! \details The length of the request in bytes is pkt_rq[0].
@@ -20,6 +20,7 @@
 #include "tas_pkt_handler_rw.h"
 #include "tas_pkt.h"
 #include "tas_am15_am14.h"
+#include "tas_utils.h"
 
 // Standard includes
 #include <cassert>
@@ -27,31 +28,75 @@
 #include <cinttypes>
 #include <memory>
 #include <array>
+#include <algorithm>
 
-CTasPktHandlerRw::CTasPktHandlerRw(tas_error_info_st* ei, const tas_con_info_st* con_info)
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define TPHR_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+CTasPktHandlerRw::CTasPktHandlerRw(tas_error_info_st* ei, const tas_con_info_st* con_info, void* arena)
     : CTasPktHandlerBase(ei)
 {
-    mInit(PKT_BUF_SIZE_DEFAULT, PKT_BUF_SIZE_DEFAULT, con_info->pl0_max_num_rw);
+    mInit(PKT_BUF_SIZE_DEFAULT, PKT_BUF_SIZE_DEFAULT, con_info->pl0_max_num_rw, arena);
     assert(mConInfo.max_pl2rq_pkt_size >= con_info->max_pl2rq_pkt_size);
     assert(mConInfo.max_pl2rsp_pkt_size >= con_info->max_pl2rsp_pkt_size);
     memcpy(&mConInfo, con_info, sizeof(tas_con_info_st));
 }
 
-CTasPktHandlerRw::CTasPktHandlerRw(tas_error_info_st* ei, uint32_t max_rq_size, uint32_t max_rsp_size, uint32_t max_num_rw)
+CTasPktHandlerRw::CTasPktHandlerRw(tas_error_info_st* ei, uint32_t max_rq_size, uint32_t max_rsp_size, uint32_t max_num_rw, void* arena)
     : CTasPktHandlerBase(ei)
 {
-    mInit(max_rq_size, max_rsp_size, max_num_rw);
+    mInit(max_rq_size, max_rsp_size, max_num_rw, arena);
+}
+
+size_t tphrAlign8(size_t num_bytes) { return (num_bytes + 7) & ~(size_t)7; }
+
+//! \brief Take a list of num elements from the arena and advance the arena pointer to the next 8 byte boundary
+template <typename T>
+T* tphrArenaTake(uint8_t** arena, size_t num)
+{
+    T* list = (T*)*arena;
+    *arena += tphrAlign8(num * sizeof(T));
+    return list;
 }
 
-void CTasPktHandlerRw::mInit(uint32_t max_rq_size, uint32_t max_rsp_size, uint32_t max_num_rw)
+size_t CTasPktHandlerRw::get_arena_size(uint32_t max_rq_size, uint32_t max_num_rw)
+{
+    size_t n = max_num_rw;
+    return tphrAlign8(max_rq_size)                      // mRqBuf
+        + tphrAlign8(n * sizeof(uint64_t))             // mPl0TrAddr
+        + tphrAlign8(n * sizeof(void*))                // mPl0TrData
+        + tphrAlign8(n * sizeof(uint16_t))             // mPl0TrNumBytes
+        + 3 * tphrAlign8(n * sizeof(uint32_t))         // mPl0TrAttr, mPl0TrRwIdx, mPl0RqDataWi
+        + 2 * tphrAlign8(n * sizeof(tas_rw_trans_rsp_st))   // mRwTransRsp, mPl0TransRsp
+        + tphrAlign8(n * sizeof(tas_rsp_plan_pl2_st))  // mRspPlanPl2
+        + tphrAlign8(n * sizeof(tas_rsp_plan_rd_st))   // mRspPlanRd
+        + 2 * tphrAlign8(n * sizeof(uint32_t));        // mRspPlanHdrWi, mRspPlanHdr
+}
+
+void CTasPktHandlerRw::mInit(uint32_t max_rq_size, uint32_t max_rsp_size, uint32_t max_num_rw, void* arena)
 {
     assert(max_rq_size % 4 == 0);
     assert(max_rsp_size % 4 == 0);
     assert(max_rq_size >= 4 * BUF_ALLOWANCE);  // There is no reason not to be generous
     assert(max_rsp_size >= 4 * BUF_ALLOWANCE);  // There is no reason not to be generous
 
-    // From CTasPktHandlerBase, allocated and set here in the derived class:
-    mRqBuf = new uint32_t[max_rq_size / 4];
+    // Request buffer and transaction lists are taken from one arena. 8 byte elements first.
+    size_t arenaSize = get_arena_size(max_rq_size, max_num_rw);
+    mArenaOwned.reset();
+    if (arena == nullptr) {
+        mArenaOwned.reset(new uint64_t[arenaSize / 8]);
+        arena = mArenaOwned.get();
+    }
+    assert(((uintptr_t)arena % 8) == 0);
+    auto a = (uint8_t*)arena;
+
+    // From CTasPktHandlerBase, set here in the derived class:
+    mRqBuf = tphrArenaTake<uint32_t>(&a, max_rq_size / 4);
     mMaxRqSize = max_rq_size - BUF_ALLOWANCE;
     mRqWiMax = mMaxRqSize / 4;
     mMaxRspSize = max_rsp_size - BUF_ALLOWANCE;
@@ -61,10 +106,24 @@ void CTasPktHandlerRw::mInit(uint32_t max_rq_size, uint32_t max_rsp_size, uint32
     mConInfo.pl0_max_num_rw = max_num_rw;
 
     mNumTransMax = max_num_rw;
-    mRwTrans = new tas_rw_trans_st[mNumTransMax];
-    mRwTransRsp = new tas_rw_trans_rsp_st[mNumTransMax];
-    mPl0Trans = new tas_rw_trans_st[mNumTransMax];
-    mPl0TransRsp = new tas_rw_trans_rsp_st[mNumTransMax];
+    mPl0TrAddr = tphrArenaTake<uint64_t>(&a, mNumTransMax);
+    mPl0TrData = tphrArenaTake<void*>(&a, mNumTransMax);
+    mPl0TrAttr = tphrArenaTake<uint32_t>(&a, mNumTransMax);
+    mPl0TrRwIdx = tphrArenaTake<uint32_t>(&a, mNumTransMax);
+    mPl0RqDataWi = tphrArenaTake<uint32_t>(&a, mNumTransMax);
+    mRwTransRsp = tphrArenaTake<tas_rw_trans_rsp_st>(&a, mNumTransMax);
+    mPl0TransRsp = tphrArenaTake<tas_rw_trans_rsp_st>(&a, mNumTransMax);
+    mPl0TrNumBytes = tphrArenaTake<uint16_t>(&a, mNumTransMax);
+    // Each PL2 packet and each read holds at least one PL0 transaction
+    mRspPlanPl2 = tphrArenaTake<tas_rsp_plan_pl2_st>(&a, mNumTransMax);
+    mRspPlanRd = tphrArenaTake<tas_rsp_plan_rd_st>(&a, mNumTransMax);
+    mRspPlanHdrWi = tphrArenaTake<uint32_t>(&a, mNumTransMax);
+    mRspPlanHdr = tphrArenaTake<uint32_t>(&a, mNumTransMax);
+    assert(a == (uint8_t*)arena + arenaSize);
+    mPl0Trans.reset();  // Only allocated by rw_get_pl0_trans()
+    mRspPlanNumPl2 = 0;
+    mRspPlanNumHdr = 0;
+    mRspPlanNumRd = 0;
 
     mRqBufWi = 0;
     mPl0NumTrans = 0;
@@ -79,19 +138,12 @@ void CTasPktHandlerRw::mInit(uint32_t max_rq_size, uint32_t max_rsp_size, uint32
     mPl0BaseAddr = 0;
 
     mGetPktRqWasCalled = false;
+    mRspPlanValid = false;
+    mSingleValid = false;
 
     mDeviceResetCount = 0;
 }
 
-CTasPktHandlerRw::~CTasPktHandlerRw()
-{
-    delete[] mRqBuf;
-    delete[] mRwTrans;
-    delete[] mRwTransRsp;
-    delete[] mPl0Trans;
-    delete[] mPl0TransRsp;
-}
-
 void CTasPktHandlerRw::rw_start()
 {
     mNumPl2Pkt = 0;
@@ -110,6 +162,8 @@ void CTasPktHandlerRw::rw_start()
     mRspSize = 0;  // Updated in mPl2PktInit()
     mPl2PktInit();
 
+    mRspPl0Idx = 0;
+
     mPl2RspPktStart = 0;
 
     mMaxWrDataBlkSizeInPktRq  = mConInfo.max_pl2rq_pkt_size  - 24;  // For blk
@@ -121,6 +175,8 @@ void CTasPktHandlerRw::rw_start()
 
     mPl1CntOutstandingOldest = mPl1CntOutstandingLast + 1; 
     mGetPktRqWasCalled = false;
+    mRspPlanValid = false;
+    mSingleValid = false;
 }
 
 void CTasPktHandlerRw::mPktAdd_SetAddrMapAccModeBaseAddr(uint8_t addr_map, uint16_t acc_mode, uint64_t addr)
@@ -242,19 +298,7 @@ void CTasPktHandlerRw::mPktAdd_Rd(uint64_t addr, uint32_t num_bytes, void* data,
         mRspSize += sizeof(tas_pl0rsp_rd_st) + num_bytes;
     }
 
-    tas_rw_trans_st* pt = &mPl0Trans[mPl0NumTrans];
-    pt->addr = addr;
-    pt->num_bytes = num_bytes;
-    pt->acc_mode = mPl0AccMode;
-    pt->addr_map = mPl0AddrMap;
-    pt->type = TAS_RW_TT_RD;
-    pt->rdata = data;
-
-    mPl0TransRsp[mPl0NumTrans].num_bytes_ok = 0;
-    mPl0TransRsp[mPl0NumTrans].pl_err = TAS_PL_ERR_PROTOCOL;
-    
-    mPl0NumTrans++;
-    mPl2NumTrans++;
+    mPl0TransAdd(addr, num_bytes, TAS_RW_TT_RD, data, 0);
 }
 
 void CTasPktHandlerRw::mPktAdd_Wr(uint64_t addr, uint32_t num_bytes, const void* data, uint16_t acc_mode, uint8_t addr_map)
@@ -275,6 +319,7 @@ void CTasPktHandlerRw::mPktAdd_Wr(uint64_t addr, uint32_t num_bytes, const void*
     mPktFinalizeIfNeeded(numBytesNeededPktrq, numBytesNeededPktrsp);
 
     mPktAdd_SetAddrMapAccModeBaseAddr(addr_map, acc_mode, addr);
+    uint32_t rqDataWi = mRqBufWi + 1;  // Payload follows the PL0 header
 
     if (num_bytes <= 8) {
         auto pl0Wr = (tas_pl0rq_wr_st*)&mRqBuf[mRqBufWi];
@@ -319,19 +364,7 @@ void CTasPktHandlerRw::mPktAdd_Wr(uint64_t addr, uint32_t num_bytes, const void*
         mRspSize += sizeof(tas_pl0rsp_wr_st);
     }
 
-    tas_rw_trans_st* pt = &mPl0Trans[mPl0NumTrans];
-    pt->addr = addr;
-    pt->num_bytes = num_bytes;
-    pt->acc_mode = mPl0AccMode;
-    pt->addr_map = mPl0AddrMap;
-    pt->type = TAS_RW_TT_WR;
-    pt->wdata = data;
-
-    mPl0TransRsp[mPl0NumTrans].num_bytes_ok = 0;
-    mPl0TransRsp[mPl0NumTrans].pl_err = TAS_PL_ERR_PROTOCOL;
-
-    mPl0NumTrans++;
-    mPl2NumTrans++;
+    mPl0TransAdd(addr, num_bytes, TAS_RW_TT_WR, const_cast<void*>(data), rqDataWi);
 }
 
 void CTasPktHandlerRw::mPktAdd_Fill(uint64_t addr, uint32_t num_bytes, uint64_t value, uint16_t acc_mode, uint8_t addr_map)
@@ -344,7 +377,7 @@ void CTasPktHandlerRw::mPktAdd_Fill(uint64_t addr, uint32_t num_bytes, uint64_t
     }
 
     uint32_t numBytesAmAmBa = mGetNumBytesAddrMapAccModeBaseAddr(addr_map, acc_mode, addr);
-    uint32_t numBytesNeededPktrq = numBytesAmAmBa + sizeof(tas_pl0rq_wrblk_st) + 8 + sizeof(tas_pl1rq_pl0_end_st);
+    uint32_t numBytesNeededPktrq = numBytesAmAmBa + sizeof(tas_pl0rq_fill_st) + sizeof(tas_pl1rq_pl0_end_st);
     uint32_t numBytesNeededPktrsp = sizeof(tas_pl0rsp_wr_st) + sizeof(tas_pl1rsp_pl0_end_st);
     mPktFinalizeIfNeeded(numBytesNeededPktrq, numBytesNeededPktrsp);
 
@@ -362,16 +395,33 @@ void CTasPktHandlerRw::mPktAdd_Fill(uint64_t addr, uint32_t num_bytes, uint64_t
     assert(mRqBufWi < mRqWiMax);
     mRspSize += sizeof(tas_pl0rsp_wr_st);
 
-    tas_rw_trans_st* pt = &mPl0Trans[mPl0NumTrans];
-    pt->addr = addr;
-    pt->num_bytes = num_bytes;
-    pt->acc_mode = mPl0AccMode;
-    pt->addr_map = mPl0AddrMap;
-    pt->type = TAS_RW_TT_FILL;
-    pt->wdata = &pl0Fill->value;
+    mPl0TransAdd(addr, num_bytes, TAS_RW_TT_FILL, &pl0Fill->value, 0);  // Fill value is not re-armed
+}
 
-    mPl0TransRsp[mPl0NumTrans].num_bytes_ok = 0;
-    mPl0TransRsp[mPl0NumTrans].pl_err = TAS_PL_ERR_PROTOCOL;
+uint32_t tphrPl0Attr(tas_rw_trans_type_et type, uint8_t addr_map, uint16_t acc_mode)
+{
+    return (uint32_t)type | ((uint32_t)addr_map << 8) | ((uint32_t)acc_mode << 16);
+}
+
+tas_rw_trans_type_et tphrPl0AttrType(uint32_t attr) { return (tas_rw_trans_type_et)(attr & 0xFF); }
+uint8_t  tphrPl0AttrAddrMap(uint32_t attr) { return (uint8_t)(attr >> 8); }
+uint16_t tphrPl0AttrAccMode(uint32_t attr) { return (uint16_t)(attr >> 16); }
+
+void CTasPktHandlerRw::mPl0TransAdd(uint64_t addr, uint32_t num_bytes, tas_rw_trans_type_et type, void* data, uint32_t rq_data_wi)
+{
+    assert(mPl0NumTrans < mNumTransMax);
+    assert(num_bytes <= TAS_PL0_DATA_BLK_SIZE);
+
+    uint32_t p = mPl0NumTrans;
+    mPl0TrAddr[p] = addr;
+    mPl0TrNumBytes[p] = (uint16_t)num_bytes;
+    mPl0TrAttr[p] = tphrPl0Attr(type, mPl0AddrMap, mPl0AccMode);
+    mPl0TrData[p] = data;
+    mPl0TrRwIdx[p] = mRwNumTrans;  // RW transaction which is currently added
+    mPl0RqDataWi[p] = rq_data_wi;
+
+    mPl0TransRsp[p].num_bytes_ok = 0;
+    mPl0TransRsp[p].pl_err = TAS_PL_ERR_PROTOCOL;
 
     mPl0NumTrans++;
     mPl2NumTrans++;
@@ -557,6 +607,61 @@ bool CTasPktHandlerRw::mNumTransManageableWr(uint64_t addr, uint32_t num_bytes)
     }
 }
 
+uint32_t CTasPktHandlerRw::mGetNumPl0TransMax(tas_rw_trans_type_et type, uint64_t addr, uint32_t num_bytes) const
+{
+    assert((type == TAS_RW_TT_RD) || (type == TAS_RW_TT_WR));
+
+    if (num_bytes <= 8) {
+        if (tphrCheckIfNaturalAligned(addr, num_bytes))
+            return 1;
+        else if ((num_bytes == 8) && (addr % 8 == 4))
+            return 2; // 32bit aligned DAS block transfer
+        return 4;  // Worst case for unaligned access
+    }
+
+    // Unaligned head and tail with up to 3 transactions each, same split as in rw_add_rd() and rw_add_wr()
+    uint32_t numTrans = 0;
+    uint64_t a = addr;
+    uint32_t nb = num_bytes;
+    if (a & 1) { numTrans++; a++; nb--; }
+    if ((nb >= 2) && (a & 2)) { numTrans++; a += 2; nb -= 2; }
+    if ((nb >= 4) && (a & 4)) { numTrans++; a += 4; nb -= 4; }
+    uint32_t nbBlk = nb & ~0x7;
+    numTrans += ((nb & 4) ? 1 : 0) + ((nb & 2) ? 1 : 0) + (nb & 1);
+
+    uint32_t maxBlkSize, pktSize, numBytesPktOverhead, numBytesBlkOverhead;
+    if (type == TAS_RW_TT_RD) {
+        maxBlkSize = mMaxRdDataBlkSizeInPktRsp;
+        pktSize = std::min(mConInfo.max_pl2rsp_pkt_size, mMaxRspSize);
+        numBytesPktOverhead = sizeof(uint32_t) + sizeof(tas_pl1rsp_pl0_start_st) + sizeof(tas_pl1rsp_pl0_end_st);
+        numBytesBlkOverhead = sizeof(tas_pl0rsp_rd_st);
+    }
+    else {
+        maxBlkSize = mMaxWrDataBlkSizeInPktRq;
+        pktSize = std::min(mConInfo.max_pl2rq_pkt_size, mRqWiMax * 4);
+        // Access mode, address map and base address are set again at the start of each PL2 packet
+        numBytesPktOverhead = sizeof(uint32_t) + sizeof(tas_pl1rq_pl0_start_st) + sizeof(tas_pl1rq_pl0_end_st)
+            + sizeof(tas_pl0rq_acc_mode_st) + sizeof(tas_pl0rq_addr_map_st) + sizeof(tas_pl0rq_base_addr64_st);
+        numBytesBlkOverhead = sizeof(tas_pl0rq_wrblk_st);
+    }
+    if (nbBlk == 0)
+        return numTrans;
+
+    uint32_t numBlk = (nbBlk + maxBlkSize - 1) / maxBlkSize;
+    if (!mPackTight && (maxBlkSize < TAS_PL0_DATA_BLK_SIZE))
+        return numTrans + numBlk + 1;  // Each block after a shortened first one starts a new PL2 packet
+
+    // Block data which fits at least into each new PL2 packet
+    uint32_t numBlkPerPktMax = pktSize / maxBlkSize + 1;
+    uint32_t numBytesOverhead = numBytesPktOverhead + (numBlkPerPktMax * numBytesBlkOverhead) + 8;
+    if (pktSize <= numBytesOverhead + 8)
+        return numTrans + 2 * numBlk + 1;  // Each block can be shortened
+
+    // Each PL2 packet boundary shortens at most one block. The current packet can be almost full.
+    uint32_t numPl2Boundary = 1 + nbBlk / (pktSize - numBytesOverhead);
+    return numTrans + numBlk + std::min(numPl2Boundary, numBlk);
+}
+
 uint32_t CTasPktHandlerRw::mGetRemainingSizeInPktRq() const
 {
     assert(mRqBufWi > mPl2HdrWi);
@@ -640,19 +745,59 @@ uint32_t CTasPktHandlerRw::mGetRdDataBlkSizeInPktRsp(uint32_t num_bytes) const
     return nb & ~0x7;  // Multiple of 64 bits;
 }
 
+uint32_t CTasPktHandlerRw::mGetDataBlkSizeTight(tas_rw_trans_type_et type, uint64_t addr, uint32_t num_bytes, uint16_t acc_mode, uint8_t addr_map)
+{
+    assert(num_bytes >= 8);
+    assert((type == TAS_RW_TT_RD) || (type == TAS_RW_TT_WR));
+
+    // Second try is in a new PL2 packet which always has room for a block transfer
+    for (int k = 0; k < 2; k++) {
+        if (mPl2NumTrans < mConInfo.pl0_max_num_rw) {
+            uint32_t numBytesAmAmBa = mGetNumBytesAddrMapAccModeBaseAddr(addr_map, acc_mode, addr);
+            uint32_t numBytesRemainingRq  = mGetRemainingSizeInPktRq();
+            uint32_t numBytesRemainingRsp = mGetRemainingSizeInPktRsp();
+            uint32_t nb = 0;
+            if (type == TAS_RW_TT_RD) {
+                uint32_t numBytesProtocolRq  = numBytesAmAmBa + sizeof(tas_pl0rq_rdblk_st) + sizeof(tas_pl1rq_pl0_end_st);
+                uint32_t numBytesProtocolRsp = sizeof(tas_pl0rsp_rd_st) + sizeof(tas_pl1rsp_pl0_end_st);
+                if ((numBytesProtocolRq <= numBytesRemainingRq) && (numBytesProtocolRsp < numBytesRemainingRsp))
+                    nb = std::min({ num_bytes, numBytesRemainingRsp - numBytesProtocolRsp, mMaxRdDataBlkSizeInPktRsp });
+            }
+            else {
+                uint32_t numBytesProtocolRq  = numBytesAmAmBa + sizeof(tas_pl0rq_wrblk_st) + sizeof(tas_pl1rq_pl0_end_st);
+                uint32_t numBytesProtocolRsp = sizeof(tas_pl0rsp_wr_st) + sizeof(tas_pl1rsp_pl0_end_st);
+                if ((numBytesProtocolRq < numBytesRemainingRq) && (numBytesProtocolRsp <= numBytesRemainingRsp))
+                    nb = std::min({ num_bytes, numBytesRemainingRq - numBytesProtocolRq, mMaxWrDataBlkSizeInPktRq });
+            }
+            nb &= ~0x7;  // Multiple of 64 bits
+            if (nb > 0)
+                return nb;
+        }
+        mPktFinalize();  // Start new PL2 packet
+    }
+    assert(false);
+    return 0;
+}
+
 bool CTasPktHandlerRw::rw_add_rd(uint64_t addr, uint32_t num_bytes, void* data, uint16_t acc_mode, uint8_t addr_map)
 {
     if (num_bytes == 0)
         return false;  // Useful for simple regression testing loops -> no assertion
 
+    if (num_bytes > MAX_NUM_BYTES_RW)
+        return false;  // num_bytes_ok of the response is 16 bit, only reachable with large buffers
+
     if (!mCheckLimits(num_bytes, 0))
         return false;
 
+    if ((mPl0NumTrans + mGetNumPl0TransMax(TAS_RW_TT_RD, addr, num_bytes)) > mNumTransMax)
+        return false;  // mPl0Trans is full
+
     uint8_t addrMap = (addr_map == TAS_AM132) ? TAS_AM15 : addr_map;
     if (addrMap > TAS_AM15)
         return false;
 
-    if (!mNumTransManageableRd(addr, num_bytes))
+    if (!mPackTight && !mNumTransManageableRd(addr, num_bytes))
         mPktFinalize();
 
     // Start new PL2 packet if needed
@@ -661,7 +806,7 @@ bool CTasPktHandlerRw::rw_add_rd(uint64_t addr, uint32_t num_bytes, void* data,
         assert(addr < 0x100000000);  // Only 32 bit addresses allowed
         newPl2Pkt = !mCheckRemainingPktSizeSufficient(32, 16 + ((num_bytes + 3) / 4) * 4);  // Never split block reads
     }
-    else {
+    else if (!mPackTight) {
         // Enforce a new PL2 packet if there is no reasonable size left for another PL0
         if (num_bytes <= 16)
             newPl2Pkt = !mCheckRemainingPktSizeSufficient(32, 16 + ((num_bytes + 3) / 4) * 4);
@@ -691,7 +836,7 @@ bool CTasPktHandlerRw::rw_add_rd(uint64_t addr, uint32_t num_bytes, void* data,
     if (nb >= 8) {
         assert((a & 0x7) == 0);  // 64 bit aligned address
         do {
-            uint32_t nbBlk = mGetRdDataBlkSizeInPktRsp(nb);
+            uint32_t nbBlk = mPackTight ? mGetDataBlkSizeTight(TAS_RW_TT_RD, a, nb, acc_mode, addrMap) : mGetRdDataBlkSizeInPktRsp(nb);
             mPktAdd_Rd(a, nbBlk, d, acc_mode, addrMap);
             if ((nbBlk < TAS_PL0_DATA_BLK_SIZE) && (nbBlk < (nb & ~0x7)))
                 mPktFinalize();  // Start new PL2 packet
@@ -715,14 +860,6 @@ bool CTasPktHandlerRw::rw_add_rd(uint64_t addr, uint32_t num_bytes, void* data,
     assert(a == addr + num_bytes);
     assert(d == (uint8_t*)data + num_bytes);
 
-    tas_rw_trans_st* pt = &mRwTrans[mRwNumTrans];
-    pt->addr = addr;
-    pt->num_bytes = num_bytes;
-    pt->acc_mode = mPl0AccMode;
-    pt->addr_map = mPl0AddrMap;
-    pt->type = TAS_RW_TT_RD;
-    pt->rdata = data;
-
     mRwTransRsp[mRwNumTrans].num_bytes_ok = 0;
     mRwTransRsp[mRwNumTrans].pl_err = TAS_PL_ERR_PROTOCOL;
 
@@ -736,14 +873,20 @@ bool CTasPktHandlerRw::rw_add_wr(uint64_t addr, uint32_t num_bytes, const void*
     if (num_bytes == 0)
         return false;   // Useful for simple regression testing loops -> no assertion
 
+    if (num_bytes > MAX_NUM_BYTES_RW)
+        return false;  // num_bytes_ok of the response is 16 bit, only reachable with large buffers
+
     if (!mCheckLimits(0, num_bytes))
         return false;
 
+    if ((mPl0NumTrans + mGetNumPl0TransMax(TAS_RW_TT_WR, addr, num_bytes)) > mNumTransMax)
+        return false;  // mPl0Trans is full
+
     uint8_t addrMap = (addr_map == TAS_AM132) ? TAS_AM15 : addr_map;
     if (addrMap > TAS_AM15)
         return false;
 
-    if (!mNumTransManageableWr(addr, num_bytes))
+    if (!mPackTight && !mNumTransManageableWr(addr, num_bytes))
         mPktFinalize();
 
     // Start new PL2 packet if needed
@@ -752,7 +895,7 @@ bool CTasPktHandlerRw::rw_add_wr(uint64_t addr, uint32_t num_bytes, const void*
         assert(addr < 0x100000000);  // Only 32 bit addresses allowed
         newPl2Pkt = !mCheckRemainingPktSizeSufficient(32 + ((num_bytes + 3) / 4) * 4, 32);  // Never split block writes
     }
-    else {
+    else if (!mPackTight) {
         // Enforce a new PL2 packet if there is no reasonable size left for another PL0
         if (num_bytes <= 16)
             newPl2Pkt = !mCheckRemainingPktSizeSufficient(32 + ((num_bytes + 3) / 4) * 4, 32);
@@ -782,7 +925,7 @@ bool CTasPktHandlerRw::rw_add_wr(uint64_t addr, uint32_t num_bytes, const void*
     if (nb >= 8) {
         assert((a & 0x7) == 0);  // 64 bit aligned address
         do {
-            uint32_t nbBlk = mGetWrDataBlkSizeInPktRq(nb, a);
+            uint32_t nbBlk = mPackTight ? mGetDataBlkSizeTight(TAS_RW_TT_WR, a, nb, acc_mode, addrMap) : mGetWrDataBlkSizeInPktRq(nb, a);
             mPktAdd_Wr(a, nbBlk, d, acc_mode, addrMap);
             if ((nbBlk < TAS_PL0_DATA_BLK_SIZE) && (nbBlk < (nb & ~0x7)))
                 mPktFinalize();  // Start new PL2 packet
@@ -806,14 +949,6 @@ bool CTasPktHandlerRw::rw_add_wr(uint64_t addr, uint32_t num_bytes, const void*
     assert(a == addr + num_bytes);
     assert(d == (const uint8_t*)data + num_bytes);
 
-    tas_rw_trans_st* pt = &mRwTrans[mRwNumTrans];
-    pt->addr = addr;
-    pt->num_bytes = num_bytes;
-    pt->acc_mode = mPl0AccMode;
-    pt->addr_map = mPl0AddrMap;
-    pt->type = TAS_RW_TT_WR;
-    pt->wdata = data;
-
     mRwTransRsp[mRwNumTrans].num_bytes_ok = 0;
     mRwTransRsp[mRwNumTrans].pl_err = TAS_PL_ERR_PROTOCOL;
 
@@ -830,14 +965,20 @@ bool CTasPktHandlerRw::rw_add_fill(uint64_t addr, uint32_t num_bytes, uint64_t v
         return false;
     }
 
-    if (!mCheckLimits(0, num_bytes))  // 8 not num_bytes for fill
+    // Only the fill value is in the request. Worst case is a base address for each FILL.
+    uint32_t numPl0Trans = (num_bytes + TAS_PL0_DATA_BLK_SIZE - 1) / TAS_PL0_DATA_BLK_SIZE;
+    uint32_t numBytesRq = numPl0Trans * (sizeof(tas_pl0rq_fill_st) + sizeof(tas_pl0rq_base_addr64_st));
+    if (!mCheckLimits(numPl0Trans * sizeof(tas_pl0rsp_wr_st), numBytesRq))
         return false;
 
-    if (!mNumTransManageableWr(addr, 8))  // 8 not num_bytes for fill
+    if ((mPl0NumTrans + numPl0Trans) > mNumTransMax)
+        return false;  // mPl0Trans is full
+
+    if (!mPackTight && !mNumTransManageableWr(addr, 8))  // 8 not num_bytes for fill
         mPktFinalize();
 
     // Start new PL2 packet if needed
-    bool newPl2Pkt = !mCheckRemainingPktSizeSufficient(32 + 8, 32);  // 8 not num_bytes for fill
+    bool newPl2Pkt = !mPackTight && !mCheckRemainingPktSizeSufficient(32 + 8, 32);  // 8 not num_bytes for fill
     newPl2Pkt |= !mCheckAddrMapRulesInPkt(addr_map);
     if (newPl2Pkt)
         mPktFinalize();  // Start new PL2 packet
@@ -850,14 +991,6 @@ bool CTasPktHandlerRw::rw_add_fill(uint64_t addr, uint32_t num_bytes, uint64_t v
         a += nbNow; nb -= nbNow;
     } while (nb > 0);
 
-    tas_rw_trans_st* pt = &mRwTrans[mRwNumTrans];
-    pt->addr = addr;
-    pt->num_bytes = num_bytes;
-    pt->acc_mode = mPl0AccMode;
-    pt->addr_map = mPl0AddrMap;
-    pt->type = TAS_RW_TT_FILL;
-    pt->wdata = nullptr;
-
     mRwTransRsp[mRwNumTrans].num_bytes_ok = 0;
     mRwTransRsp[mRwNumTrans].pl_err = TAS_PL_ERR_PROTOCOL;
 
@@ -870,8 +1003,51 @@ bool CTasPktHandlerRw::rw_set_trans(const tas_rw_trans_st* trans, uint32_t num_t
 {
     rw_start();
 
-    bool succ = false;
-    for (uint32_t t = 0; t < num_trans; t++) {
+    if (rw_add_trans(trans, num_trans) != num_trans) {
+        rw_start();  // Enforce all or nothing
+        return false;
+    }
+
+    assert(mRwNumTrans == num_trans);
+
+    return true;
+}
+
+bool CTasPktHandlerRw::rw_set_trans_packed(const tas_rw_trans_st* trans, uint32_t num_trans, tas_rw_pack_stats_st* stats)
+{
+    bool packTight = mPackTight;
+
+    if (stats) {
+        *stats = {};
+        // Greedy encoding only for the figures. PL1 counters are restored since these packets are never sent.
+        uint32_t pl1CntOutstandingLast = mPl1CntOutstandingLast;
+        mPackTight = false;
+        bool succ = rw_set_trans(trans, num_trans);
+        mPl1CntOutstandingLast = pl1CntOutstandingLast;
+        if (succ) {
+            stats->num_pl2_pkt_greedy = mNumPl2Pkt + 1;  // Including the current PL2 packet
+            stats->rq_num_bytes_greedy = rw_get_rq_size();
+            stats->rsp_num_bytes_greedy = rw_get_rsp_size();
+        }
+    }
+
+    mPackTight = true;
+    bool succ = rw_set_trans(trans, num_trans);
+    mPackTight = packTight;
+
+    if (succ && stats) {
+        stats->num_pl2_pkt = mNumPl2Pkt + 1;  // Including the current PL2 packet
+        stats->rq_num_bytes = rw_get_rq_size();
+        stats->rsp_num_bytes = rw_get_rsp_size();
+    }
+    return succ;
+}
+
+uint32_t CTasPktHandlerRw::rw_add_trans(const tas_rw_trans_st* trans, uint32_t num_trans)
+{
+    uint32_t t;
+    for (t = 0; t < num_trans; t++) {
+        bool succ;
         if (trans[t].type == TAS_RW_TT_RD) {
             succ = rw_add_rd(trans[t].addr, trans[t].num_bytes, trans[t].rdata, trans[t].acc_mode, trans[t].addr_map);
         }
@@ -886,16 +1062,10 @@ bool CTasPktHandlerRw::rw_set_trans(const tas_rw_trans_st* trans, uint32_t num_t
             assert(false);
             succ = false;
         }
-        if (succ == false) {
-            rw_start();  // Enforce all or nothing
+        if (succ == false)
             break;
-        }
     }
-
-    if (succ)
-        assert(mRwNumTrans == num_trans);
-
-    return succ;
+    return t;
 }
 
 uint32_t CTasPktHandlerRw::rw_get_rq_size() const
@@ -930,6 +1100,123 @@ void CTasPktHandlerRw::rw_get_rq(const uint32_t** rq, uint32_t* rq_num_bytes, ui
     *num_pl2_pkt = mNumPl2Pkt;
 }
 
+void CTasPktHandlerRw::rw_rearm_rq(const uint32_t** rq, uint32_t* rq_num_bytes, uint32_t* rsp_num_bytes_max, uint32_t* num_pl2_pkt)
+{
+    assert(mGetPktRqWasCalled);  // Only a finalized request can be re-armed
+
+    // Renew the PL1 counters in place. The PL2 packets are chained by their length words.
+    mPl1CntOutstandingOldest = mPl1CntOutstandingLast + 1;
+    uint32_t wiPl2Hdr = 0;
+    for (uint32_t k = 0; k < mNumPl2Pkt; k++) {
+        assert(wiPl2Hdr < mRqBufWi);
+        mPl1CntOutstandingLast++;
+        auto pl0Start = (tas_pl1rq_pl0_start_st*)&mRqBuf[wiPl2Hdr + 1];
+        pl0Start->pl1_cnt = mPl1CntOutstandingLast;
+        wiPl2Hdr += mRqBuf[wiPl2Hdr] / 4;
+    }
+    assert(wiPl2Hdr == mRqBufWi);
+
+    for (uint32_t p = 0; p < mPl0NumTrans; p++) {
+        if (mPl0RqDataWi[p] != 0) {
+            assert(tphrPl0AttrType(mPl0TrAttr[p]) == TAS_RW_TT_WR);
+            memcpy(&mRqBuf[mPl0RqDataWi[p]], mPl0TrData[p], mPl0TrNumBytes[p]);
+        }
+        mPl0TransRsp[p].num_bytes_ok = 0;
+        mPl0TransRsp[p].pl_err = TAS_PL_ERR_PROTOCOL;
+    }
+    for (uint32_t t = 0; t < mRwNumTrans; t++) {
+        mRwTransRsp[t].num_bytes_ok = 0;
+        mRwTransRsp[t].pl_err = TAS_PL_ERR_PROTOCOL;
+    }
+
+    if (!mRspPlanValid)
+        mCompileRspPlan();
+
+    *rq = mRqBuf;
+    *rq_num_bytes = rw_get_rq_size();
+    *rsp_num_bytes_max = rw_get_rsp_size();
+    *num_pl2_pkt = mNumPl2Pkt;
+}
+
+uint32_t tphrBaseAddrClass(uint64_t addr)
+{
+    if (addr <= 0xFFFF)
+        return 0;  // Covered by the default base address 0 of a PL1 packet
+    return (addr < 0x100000000) ? 1 : 2;
+}
+
+bool CTasPktHandlerRw::rw_set_trans_single(const tas_rw_trans_st* trans, const uint32_t** rq, uint32_t* rq_num_bytes, uint32_t* rsp_num_bytes_max, uint32_t* num_pl2_pkt)
+{
+    uint64_t addr = trans->addr;
+    uint32_t baseAddrClass = tphrBaseAddrClass(addr);
+
+    if (mSingleValid && mGetPktRqWasCalled
+        && (trans->type == tphrPl0AttrType(mPl0TrAttr[0])) && (trans->num_bytes == mPl0TrNumBytes[0])
+        && (trans->acc_mode == tphrPl0AttrAccMode(mPl0TrAttr[0])) && (trans->addr_map == mSingleAddrMap)
+        && (baseAddrClass == mSingleBaseAddrClass) && tphrCheckIfNaturalAligned(addr, trans->num_bytes))
+    {
+        assert((mPl0NumTrans == 1) && (mRwNumTrans == 1) && (mNumPl2Pkt == 1));
+
+        if (baseAddrClass == 1) {
+            auto pl0Ba32 = (tas_pl0rq_base_addr32_st*)&mRqBuf[mSingleWiBaseAddr];
+            pl0Ba32->ba31to16 = (uint16_t)(addr >> 16);
+        }
+        else if (baseAddrClass == 2) {
+            auto pl0Ba64 = (tas_pl0rq_base_addr64_st*)&mRqBuf[mSingleWiBaseAddr];
+            pl0Ba64->ba31to16 = (uint16_t)(addr >> 16);
+            pl0Ba64->ba63to32 = (uint32_t)(addr >> 32);
+        }
+        auto pl0Rd = (tas_pl0rq_rd_st*)&mRqBuf[mSingleWiCmd];  // Same layout as tas_pl0rq_wr_st up to a15to0
+        pl0Rd->a15to0 = (uint16_t)(addr & 0xFFFF);
+
+        mPl0TrAddr[0] = addr;
+        mPl0TrData[0] = const_cast<void*>(trans->wdata);  // Same as rdata
+
+        if (mRspPlanValid && (trans->type == TAS_RW_TT_RD)) {
+            assert(mRspPlanNumRd == 1);
+            mRspPlanRd[0].rdata = trans->rdata;
+        }
+
+        rw_rearm_rq(rq, rq_num_bytes, rsp_num_bytes_max, num_pl2_pkt);
+        return true;
+    }
+
+    if (!rw_set_trans(trans, 1))
+        return false;
+    rw_get_rq(rq, rq_num_bytes, rsp_num_bytes_max, num_pl2_pkt);
+
+    // Keep as template if the request consists of a single PL0 read or write
+    if ((mPl0NumTrans == 1) && (*num_pl2_pkt == 1) && (trans->num_bytes <= 8)
+        && ((trans->type == TAS_RW_TT_RD) || (trans->type == TAS_RW_TT_WR)))
+    {
+        uint32_t wi = 3;  // After PL2 length and tas_pl1rq_pl0_start_st
+        if (tphrPl0AttrAddrMap(mPl0TrAttr[0]) != TAS_AM0)
+            wi += 1;
+        if (tphrPl0AttrAccMode(mPl0TrAttr[0]) != 0)
+            wi += 1;
+        mSingleAddrMap = trans->addr_map;  // Can differ from the PL0 address map, e.g. TAS_AM132
+        mSingleBaseAddrClass = baseAddrClass;
+        mSingleWiBaseAddr = wi;
+        if (baseAddrClass == 1)
+            wi += 1;
+        else if (baseAddrClass == 2)
+            wi += 2;
+        mSingleWiCmd = wi;
+        assert((((const tas_pl0rq_rd_st*)&mRqBuf[wi])->a15to0) == (uint16_t)(addr & 0xFFFF));
+        assert((mPl0RqDataWi[0] == 0) || (mPl0RqDataWi[0] == wi + 1));
+        mSingleValid = true;
+    }
+
+    return true;
+}
+
+void CTasPktHandlerRw::rw_get_limits(uint32_t* max_rq_size, uint32_t* max_rsp_size, uint32_t* max_num_rw) const
+{
+    *max_rq_size  = mMaxRqSize + BUF_ALLOWANCE;
+    *max_rsp_size = mMaxRspSize + BUF_ALLOWANCE;
+    *max_num_rw   = mNumTransMax;
+}
+
 uint32_t CTasPktHandlerRw::rw_get_num_pl2_pkt(const uint32_t* rsp, uint32_t num_bytes) const
 {
     if (mNumPl2Pkt == 0) {
@@ -991,6 +1278,226 @@ bool ctprhcPl0CmdIsWrOrFill(tas_pl_cmd_et cmd)
     }
 }
 
+//! \brief Compare response header words against their expected values. Scalar version.
+//! \details Differences are accumulated without branching. Used as fallback and for the remainder of the vector version.
+static bool tphrRspHdrMatchScalar(const uint32_t* rsp, const uint32_t* wi, const uint32_t* hdr, uint32_t num)
+{
+    uint32_t diff = 0;
+    for (uint32_t i = 0; i < num; i++)
+        diff |= rsp[wi[i]] ^ hdr[i];
+    return (diff == 0);
+}
+
+#ifdef TPHR_X86
+
+//! \brief Compare response header words against their expected values. AVX2 version with gathered loads of 8 headers.
+#if defined(__GNUC__)
+__attribute__((target("avx2")))
+#endif
+static bool tphrRspHdrMatchAvx2(const uint32_t* rsp, const uint32_t* wi, const uint32_t* hdr, uint32_t num)
+{
+    __m256i diff = _mm256_setzero_si256();
+    uint32_t i = 0;
+    for (; i + 8 <= num; i += 8) {
+        __m256i idx = _mm256_loadu_si256((const __m256i*)&wi[i]);
+        __m256i h   = _mm256_i32gather_epi32((const int*)rsp, idx, 4);
+        diff = _mm256_or_si256(diff, _mm256_xor_si256(h, _mm256_loadu_si256((const __m256i*)&hdr[i])));
+    }
+    if (!_mm256_testz_si256(diff, diff))
+        return false;
+    return tphrRspHdrMatchScalar(rsp, &wi[i], &hdr[i], num - i);
+}
+
+//! \brief Check if the CPU and the OS support AVX2
+static bool tphrCpuHasAvx2()
+{
+#if defined(_MSC_VER)
+    std::array<int, 4> info;
+    __cpuid(info.data(), 0);
+    if (info[0] < 7)
+        return false;
+    __cpuid(info.data(), 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    if (!osxsave || ((_xgetbv(0) & 0x6) != 0x6))  // XMM and YMM state enabled by the OS
+        return false;
+    __cpuidex(info.data(), 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();  // Can be called before the constructors of libgcc have run
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif  // TPHR_X86
+
+//! \brief Function pointer type of the header validation kernels
+typedef bool (*tphr_rsp_hdr_match_ft)(const uint32_t* rsp, const uint32_t* wi, const uint32_t* hdr, uint32_t num);
+
+//! \brief Select the header validation kernel at runtime
+static tphr_rsp_hdr_match_ft tphrRspHdrMatchSelect()
+{
+#ifdef TPHR_X86
+    if (tphrCpuHasAvx2())
+        return tphrRspHdrMatchAvx2;
+#endif
+    return tphrRspHdrMatchScalar;
+}
+
+//! \brief Header validation kernel for this CPU
+//! \details Selected on first use and not during static initialization, where the CPU features may not be known yet.
+static bool tphrRspHdrMatch(const uint32_t* rsp, const uint32_t* wi, const uint32_t* hdr, uint32_t num)
+{
+    static const tphr_rsp_hdr_match_ft rspHdrMatch = tphrRspHdrMatchSelect();
+    return rspHdrMatch(rsp, wi, hdr, num);
+}
+
+bool CTasPktHandlerRw::rsp_hdr_kernel_supported(tas_rsp_hdr_kernel_et kernel)
+{
+    switch (kernel) {
+    case RSP_HDR_KERNEL_SCALAR: return true;
+#ifdef TPHR_X86
+    case RSP_HDR_KERNEL_AVX2:   return tphrCpuHasAvx2();
+#endif
+    default:
+        return false;
+    }
+}
+
+bool CTasPktHandlerRw::rsp_hdr_match(tas_rsp_hdr_kernel_et kernel, const uint32_t* rsp, const uint32_t* wi, const uint32_t* hdr, uint32_t num)
+{
+    assert(rsp_hdr_kernel_supported(kernel));
+#ifdef TPHR_X86
+    if (kernel == RSP_HDR_KERNEL_AVX2)
+        return tphrRspHdrMatchAvx2(rsp, wi, hdr, num);
+#endif
+    return tphrRspHdrMatchScalar(rsp, wi, hdr, num);
+}
+
+void CTasPktHandlerRw::mCompileRspPlan()
+{
+    assert(mGetPktRqWasCalled);
+
+    mRspPlanNumPl2 = 0;
+    mRspPlanNumHdr = 0;
+    mRspPlanNumRd = 0;
+
+    uint32_t wiRq = 0;
+    uint32_t wiRspTotal = 0;
+    uint32_t p = 0;
+    for (uint32_t k = 0; k < mNumPl2Pkt; k++) {
+        uint32_t wiRqPl2End = wiRq + mRqBuf[wiRq] / 4;
+        tas_rsp_plan_pl2_st pl2 = { 0, p, 0, mRspPlanNumRd, 0 };
+        uint32_t wiRsp = 2;  // Word index in the PL2 response packet after its length and tas_pl1rsp_pl0_start_st
+        wiRq += 3;           // PL2 packet length and tas_pl1rq_pl0_start_st
+        while (wiRq < wiRqPl2End) {
+            uint8_t wl  = mRqBuf[wiRq] & 0xFF;
+            auto    cmd = (tas_pl_cmd_et)((mRqBuf[wiRq] >> 8) & 0xFF);
+            if (cmd == TAS_PL1_CMD_PL0_END) {
+                wiRq++;
+                wiRsp++;
+                break;
+            }
+            wiRq += 1 + ((cmd == TAS_PL0_CMD_WRBLK) && (wl == 0) ? 256 : wl);
+            if ((cmd == TAS_PL0_CMD_ADDR_MAP) || (cmd == TAS_PL0_CMD_ACCESS_MODE) ||
+                (cmd == TAS_PL0_CMD_BASE_ADDR32) || (cmd == TAS_PL0_CMD_BASE_ADDR64)) {
+                continue;  // No response
+            }
+
+            assert(p < mPl0NumTrans);
+            uint32_t numBytes = mPl0TrNumBytes[p];
+            uint32_t wlrw = (numBytes + 3) / 4;
+            uint32_t hdr;
+            if (ctprhcPl0CmdIsRd(cmd)) {
+                assert(tphrPl0AttrType(mPl0TrAttr[p]) == TAS_RW_TT_RD);
+                if (wlrw == 0x100)  // 1KB block read has a dedicated response
+                    hdr = (TAS_PL0_CMD_RDBLK1KB << 8) | ((uint32_t)TAS_PL0_ERR_NO_ERROR << 24);
+                else
+                    hdr = wlrw | (cmd << 8) | (wlrw << 16) | ((uint32_t)TAS_PL0_ERR_NO_ERROR << 24);
+                assert(mRspPlanNumRd < mNumTransMax);
+                mRspPlanRd[mRspPlanNumRd++] = { wiRsp, numBytes, mPl0TrData[p] };
+            }
+            else {
+                assert(ctprhcPl0CmdIsWrOrFill(cmd));
+                hdr = (cmd << 8) | ((wlrw & 0xFF) << 16) | ((uint32_t)TAS_PL0_ERR_NO_ERROR << 24);
+                wlrw = 0;  // No data in the response
+            }
+            assert(mRspPlanNumHdr == p);  // One header for each PL0 transaction
+            mRspPlanHdrWi[mRspPlanNumHdr] = wiRsp;
+            mRspPlanHdr[mRspPlanNumHdr] = hdr;
+            mRspPlanNumHdr++;
+            wiRsp += 1 + wlrw;
+            p++;
+        }
+        assert(wiRq == wiRqPl2End);
+        pl2.num_bytes = wiRsp * 4;
+        pl2.pl0_end = p;
+        pl2.rd_end = mRspPlanNumRd;
+        assert(mRspPlanNumPl2 < mNumTransMax);
+        mRspPlanPl2[mRspPlanNumPl2++] = pl2;
+        wiRspTotal += wiRsp;
+    }
+    assert(p == mPl0NumTrans);
+    assert(wiRspTotal * 4 == mRspSize);
+    _unused(wiRspTotal);
+
+    mRspPlanValid = true;
+}
+
+bool CTasPktHandlerRw::mSetRspPl2ByPlan(const uint32_t* rsp, uint32_t num_bytes)
+{
+    if (!mRspPlanValid || (mRspPl2Idx >= mRspPlanNumPl2))
+        return false;
+
+    const tas_rsp_plan_pl2_st& e = mRspPlanPl2[mRspPl2Idx];
+    if ((e.pl0_first != mRspPl0Idx) || (num_bytes != e.num_bytes))
+        return false;
+
+    const uint32_t hdrPl1Start = (TAS_PL1_CMD_PL0_START << 8) | ((uint32_t)TAS_PL_ERR_NO_ERROR << 24);
+    const uint32_t maskPl1Start = 0xFF00FFFF;  // con_id is not checked
+    const uint32_t hdrPl0End = (TAS_PL1_CMD_PL0_END << 8) | ((uint32_t)mPl1CntOutstandingOldest << 16);
+    if ((rsp[0] != num_bytes) || ((rsp[1] & maskPl1Start) != hdrPl1Start) || (rsp[num_bytes / 4 - 1] != hdrPl0End))
+        return false;
+
+    // Validate all headers of the packet in bulk before any data is copied
+    if (!tphrRspHdrMatch(rsp, &mRspPlanHdrWi[e.pl0_first], &mRspPlanHdr[e.pl0_first], e.pl0_end - e.pl0_first))
+        return false;
+
+    for (uint32_t r = e.rd_first; r < e.rd_end; r++) {
+        const tas_rsp_plan_rd_st& rd = mRspPlanRd[r];
+        const uint32_t* d = &rsp[rd.wi + 1];
+        switch (rd.num_bytes) {  // Constant sizes for the frequent single accesses
+        case 1:  memcpy(rd.rdata, d, 1); break;
+        case 2:  memcpy(rd.rdata, d, 2); break;
+        case 4:  memcpy(rd.rdata, d, 4); break;
+        case 8:  memcpy(rd.rdata, d, 8); break;
+        default: memcpy(rd.rdata, d, rd.num_bytes); break;
+        }
+    }
+
+    for (uint32_t p = e.pl0_first; p < e.pl0_end; p++) {
+        mPl0TransRsp[p].num_bytes_ok = mPl0TrNumBytes[p];
+        mPl0TransRsp[p].pl_err = TAS_PL0_ERR_NO_ERROR;
+    }
+    mRspPl0Idx = e.pl0_end;
+
+    // Same as the end of mSetRspPl2()
+    if (mRspPl0Idx == mPl0NumTrans) {
+        assert(mPl1CntOutstandingOldest == mPl1CntOutstandingLast);
+    }
+    else {
+        mPl1CntOutstandingOldest++;
+    }
+
+    return true;
+}
+
+bool CTasPktHandlerRw::mSetRspPl2Next(const uint32_t* rsp, uint32_t num_bytes)
+{
+    bool succ = mSetRspPl2ByPlan(rsp, num_bytes) || mSetRspPl2(rsp, num_bytes);
+    mRspPl2Idx++;
+    return succ;
+}
+
 tas_return_et CTasPktHandlerRw::rw_set_rsp(const uint32_t* rsp, uint32_t num_bytes)
 {
     assert(mRwTransRsp[0].pl_err == TAS_PL_ERR_PROTOCOL);   // As well for all others
@@ -1004,40 +1511,83 @@ tas_return_et CTasPktHandlerRw::rw_set_rsp(const uint32_t* rsp, uint32_t num_byt
         return mSetPktRspErrConnectionProtocol();
     }
 
+    rw_set_rsp_begin();
+
+    uint32_t wi = 0;
+    uint32_t wiMax = num_bytes / 4;
+    while (wi < wiMax) {
+        if (rsp[wi] > (wiMax - wi) * 4) {
+            return mSetPktRspErrConnectionProtocol();  // Truncated PL2 packet
+        }
+        uint32_t numBytesPl2 = rsp[wi];
+        if (!mSetRspPl2Next(&rsp[wi], numBytesPl2)) {
+            return mEip->tas_err;
+        }
+        wi += numBytesPl2 / 4;
+        if (mRspPl0Idx == mPl0NumTrans)
+            break;
+    }
+    assert(wi == wiMax);
+
+    return mEip->tas_err;
+}
+
+void CTasPktHandlerRw::rw_set_rsp_begin()
+{
+    assert(mRwNumTrans > 0);
+    assert(mPl0NumTrans > 0);
+
     tas_clear_error_info(mEip);  // Capture first error
+    mRspPl0Idx = 0;
+    mRspPl2Idx = 0;
+}
 
-    uint32_t wi;
-    uint32_t wiMax;
-    uint32_t wiPktStartNext;
-    uint32_t iTrans;
-    wiMax = num_bytes / 4;
+tas_return_et CTasPktHandlerRw::rw_set_rsp_pl2(const uint32_t* rsp, uint32_t num_bytes)
+{
+    if ((num_bytes < 8) || (rsp[0] != num_bytes)) {
+        return mSetPktRspErrConnectionProtocol();
+    }
+    mSetRspPl2Next(rsp, num_bytes);
+    return mEip->tas_err;
+}
 
-    wi = wiPktStartNext = iTrans = 0;
-    while (wi < wiMax) {
+uint32_t CTasPktHandlerRw::rw_get_num_trans_done() const
+{
+    if (mRspPl0Idx == mPl0NumTrans)
+        return mRwNumTrans;
+    return mPl0TrRwIdx[mRspPl0Idx];  // RW transactions before the one of the next PL0 transaction
+}
 
-        // TAS_PL1_CMD_PL0_START
-        if (wi == wiPktStartNext) {
-            if ((rsp[wi] % 4 != 0) || (rsp[wi] > mMaxRspSize)) {
-                return mSetPktRspErrConnectionProtocol();
-            }
-            wiPktStartNext += rsp[wi] / 4;
-            auto pl1Start = (const tas_pl1rsp_pl0_start_st*)&rsp[wi+1];
-            if ((pl1Start->wl != 0) || (pl1Start->cmd != TAS_PL1_CMD_PL0_START)) {
-                return mSetPktRspErrConnectionProtocol();
-            }
-            if (pl1Start->err == TAS_PL1_ERR_DEV_ACCESS) {
-                return mSetPktRspErrDeviceAccess();
-            }
-            else if (pl1Start->err == TAS_PL1_ERR_DEV_RESET) {
-                mDeviceResetCount++;
-            }
-            else if (pl1Start->err != TAS_PL_ERR_NO_ERROR) {
-                return mSetPktRspErrConnectionProtocol();
-            }
+bool CTasPktHandlerRw::mSetRspPl2Failed()
+{
+    mSetPktRspErrConnectionProtocol();
+    return false;
+}
 
-            wi += (4 + sizeof(tas_pl1rsp_pl0_end_st)) / 4;
-            continue;
-        }
+bool CTasPktHandlerRw::mSetRspPl2(const uint32_t* rsp, uint32_t num_bytes)
+{
+    // TAS_PL1_CMD_PL0_START
+    if ((num_bytes % 4 != 0) || (num_bytes > mMaxRspSize) || (num_bytes < 4 + sizeof(tas_pl1rsp_pl0_start_st))) {
+        return mSetRspPl2Failed();
+    }
+    auto pl1Start = (const tas_pl1rsp_pl0_start_st*)&rsp[1];
+    if ((pl1Start->wl != 0) || (pl1Start->cmd != TAS_PL1_CMD_PL0_START)) {
+        return mSetRspPl2Failed();
+    }
+    if (pl1Start->err == TAS_PL1_ERR_DEV_ACCESS) {
+        mSetPktRspErrDeviceAccess();
+        return false;
+    }
+    else if (pl1Start->err == TAS_PL1_ERR_DEV_RESET) {
+        mDeviceResetCount++;
+    }
+    else if (pl1Start->err != TAS_PL_ERR_NO_ERROR) {
+        return mSetRspPl2Failed();
+    }
+
+    uint32_t wi = (4 + sizeof(tas_pl1rsp_pl0_start_st)) / 4;
+    uint32_t wiMax = num_bytes / 4;
+    while (wi < wiMax) {
 
         uint8_t       wl   = rsp[wi] & 0xFF;
         auto cmd  = (tas_pl_cmd_et)((rsp[wi] >> 8) & 0xFF);
@@ -1046,160 +1596,147 @@ tas_return_et CTasPktHandlerRw::rw_set_rsp(const uint32_t* rsp, uint32_t num_byt
         if (cmd == TAS_PL1_CMD_PL0_END) {
             auto pl1End = (const tas_pl1rsp_pl0_end_st*)&rsp[wi];
             if (pl1End->wl != 0) {
-                return mSetPktRspErrConnectionProtocol();
+                return mSetRspPl2Failed();
             }
             if (pl1End->pl1_cnt != mPl1CntOutstandingOldest) {
-                return mSetPktRspErrPl1Cnt();
+                mSetPktRspErrPl1Cnt();
+                return false;
             }
             wi += sizeof(tas_pl1rsp_pl0_end_st) / 4;
-            if (iTrans == mPl0NumTrans) {
+            if (wi != wiMax) {
+                return mSetRspPl2Failed();
+            }
+            if (mRspPl0Idx == mPl0NumTrans) {
                 assert(mPl1CntOutstandingOldest == mPl1CntOutstandingLast);
-                break;
             }
             else {
                 mPl1CntOutstandingOldest++;
-                assert(wi < wiMax);
-                continue;
             }
+            return true;
         }
 
         // TAS_PL0_CMD_
-        tas_rw_trans_rsp_st* pktRsp = &mPl0TransRsp[iTrans];
+        uint32_t wlPayload = (cmd == TAS_PL0_CMD_RDBLK1KB) ? 256 : wl;
+        if ((mRspPl0Idx >= mPl0NumTrans) || (wi + 1 + wlPayload >= wiMax)) {
+            return mSetRspPl2Failed();  // Too many PL0 transactions or no room for the payload and the PL0 end
+        }
+        tas_rw_trans_rsp_st* pktRsp = &mPl0TransRsp[mRspPl0Idx];
         assert(pktRsp->pl_err == TAS_PL_ERR_PROTOCOL);
-        tas_rw_trans_st* pt = &mPl0Trans[iTrans];
-        uint16_t wlrwNoErr = ((pt->num_bytes + 3) / 4);  // Expected wlrw value if no error
+        uint16_t ptNumBytes = mPl0TrNumBytes[mRspPl0Idx];
+        tas_rw_trans_type_et ptType = tphrPl0AttrType(mPl0TrAttr[mRspPl0Idx]);
+        uint16_t wlrwNoErr = ((ptNumBytes + 3) / 4);  // Expected wlrw value if no error
 
         if (ctprhcPl0CmdIsWrOrFill(cmd)) {
             auto pkt = (const tas_pl0rsp_wr_st*)&rsp[wi];
             if (wl != 0) {
-                return mSetPktRspErrConnectionProtocol();
+                return mSetRspPl2Failed();
             }
-            if ((pt->type != TAS_RW_TT_WR) && (pt->type != TAS_RW_TT_FILL)) {
-                return mSetPktRspErrConnectionProtocol();
+            if ((ptType != TAS_RW_TT_WR) && (ptType != TAS_RW_TT_FILL)) {
+                return mSetRspPl2Failed();
             }
             if (pkt->err != TAS_PL0_ERR_NO_ERROR) {
                 pktRsp->pl_err = pkt->err;
                 if (cmd == TAS_PL0_CMD_WRBLK) {
                     if (pkt->wlwr >= wlrwNoErr) {
-                        return mSetPktRspErrConnectionProtocol();
+                        return mSetRspPl2Failed();
                     }
                     pktRsp->num_bytes_ok = pkt->wlwr * 4;
                 }
                 else {
                     if (pkt->wlwr != 0) {
-                        return mSetPktRspErrConnectionProtocol();
+                        return mSetRspPl2Failed();
                     }
                     pktRsp->num_bytes_ok = 0;
                 }
-                mSetPktRspErrPl0Data(pktRsp->pl_err, TAS_ERR_RW_WRITE, pt->addr + pkt->wlwr * 4, pt->addr_map);
+                mSetPktRspErrPl0Data(pktRsp->pl_err, TAS_ERR_RW_WRITE, mPl0TrAddr[mRspPl0Idx] + pkt->wlwr * 4, tphrPl0AttrAddrMap(mPl0TrAttr[mRspPl0Idx]));
             }
             else {  // TAS_PL0_ERR_NO_ERROR
-                if ((pkt->wlwr != (0xFF & (pt->num_bytes + 3) / 4)) || (pkt->wl != 0)) {
-                    return mSetPktRspErrConnectionProtocol();
+                if ((pkt->wlwr != (0xFF & (ptNumBytes + 3) / 4)) || (pkt->wl != 0)) {
+                    return mSetRspPl2Failed();
                 }
                 else {
-                    pktRsp->num_bytes_ok = pt->num_bytes;
+                    pktRsp->num_bytes_ok = ptNumBytes;
                     pktRsp->pl_err = TAS_PL0_ERR_NO_ERROR;
                 }
             }
             wi += 1 + wl;
-            iTrans++;
+            mRspPl0Idx++;
         }
         else if (ctprhcPl0CmdIsRd(cmd)) {
             auto pkt = (const tas_pl0rsp_rd_st*)&rsp[wi];
             if (wl != pkt->wlrd) {
-                return mSetPktRspErrConnectionProtocol();
+                return mSetRspPl2Failed();
             }
-            if (pt->type != TAS_RW_TT_RD) {
-                return mSetPktRspErrConnectionProtocol();
+            if (ptType != TAS_RW_TT_RD) {
+                return mSetRspPl2Failed();
             }
             if (cmd == TAS_PL0_CMD_RDBLK1KB) {
                 if ((wlrwNoErr != 0x100) || (wl != 0) ||  // wl 0 means 256 words -> 1kB
                     (pkt->wlrd != 0) || (pkt->err != TAS_PL0_ERR_NO_ERROR)) {
-                    return mSetPktRspErrConnectionProtocol();
+                    return mSetRspPl2Failed();
                 }
                 pktRsp->num_bytes_ok = TAS_PL0_DATA_BLK_SIZE;
                 pktRsp->pl_err = TAS_PL0_ERR_NO_ERROR;
-                memcpy(pt->rdata, &rsp[wi + 1], TAS_PL0_DATA_BLK_SIZE);
+                memcpy(mPl0TrData[mRspPl0Idx], &rsp[wi + 1], TAS_PL0_DATA_BLK_SIZE);
                 wi += 1 + 256;
             }
             else {
                 if (pkt->err != TAS_PL0_ERR_NO_ERROR) {
                     if (cmd == TAS_PL0_CMD_RDBLK) {
                         if (pkt->wlrd > wlrwNoErr) {
-                            return mSetPktRspErrConnectionProtocol();
+                            return mSetRspPl2Failed();
                         }
                         pktRsp->num_bytes_ok = pkt->wlrd * 4;
                     }
                     else {
                         if (pkt->wlrd != 0) {
-                            return mSetPktRspErrConnectionProtocol();
+                            return mSetRspPl2Failed();
                         }
                         pktRsp->num_bytes_ok = 0;
                     }
                     pktRsp->pl_err = pkt->err;
-                    mSetPktRspErrPl0Data(pktRsp->pl_err, TAS_ERR_RW_READ, pt->addr + pkt->wlrd * 4, pt->addr_map);
+                    mSetPktRspErrPl0Data(pktRsp->pl_err, TAS_ERR_RW_READ, mPl0TrAddr[mRspPl0Idx] + pkt->wlrd * 4, tphrPl0AttrAddrMap(mPl0TrAttr[mRspPl0Idx]));
                 }
                 else {  // TAS_PL0_ERR_NO_ERROR
-                    if ((pkt->wlrd != (0xFF & (pt->num_bytes + 3) / 4)) || (pkt->wl != pkt->wlrd)) {
-                        return mSetPktRspErrConnectionProtocol();
+                    if ((pkt->wlrd != (0xFF & (ptNumBytes + 3) / 4)) || (pkt->wl != pkt->wlrd)) {
+                        return mSetRspPl2Failed();
                     }
                     else {
-                        pktRsp->num_bytes_ok = pt->num_bytes;
+                        pktRsp->num_bytes_ok = ptNumBytes;
                         pktRsp->pl_err = TAS_PL0_ERR_NO_ERROR;
                     }
                 }
-                memcpy(pt->rdata, &rsp[wi + 1], pktRsp->num_bytes_ok);
+                memcpy(mPl0TrData[mRspPl0Idx], &rsp[wi + 1], pktRsp->num_bytes_ok);
                 wi += 1 + wl;
             }
-            iTrans++;
+            mRspPl0Idx++;
         }
         else {
-            return mSetPktRspErrConnectionProtocol();
+            return mSetRspPl2Failed();
         }
     }
-    assert(wi == wiMax);
-
-    return mEip->tas_err;
+    return mSetRspPl2Failed();  // No PL0 end
 }
 
 uint32_t CTasPktHandlerRw::rw_get_trans_rsp(const tas_rw_trans_rsp_st** trans_rsp)
 {
-    assert(mPl0Trans[0].addr == mRwTrans[0].addr);
-
-    uint64_t addrStart = 0;
-    uint64_t addrEnd = 0;
-    uint64_t addrNextPl0 = 0;
-    uint32_t t = 0;
-    mRwTransRsp[t].pl_err = TAS_PL0_ERR_NO_ERROR;
-    mRwTransRsp[t].num_bytes_ok = 0;
-    for (uint32_t p = 0; p < mPl0NumTrans; p++) {
-        assert(mPl0Trans[p].type == mRwTrans[t].type);
-        if (mPl0Trans[p].addr == mRwTrans[t].addr) {
-            addrStart = mRwTrans[t].addr;
-            addrEnd   = addrStart + mRwTrans[t].num_bytes;
-        }
-        else {
-            assert(mPl0Trans[p].addr == addrNextPl0);
-        }
-        addrNextPl0 = mPl0Trans[p].addr + mPl0Trans[p].num_bytes;  // In case an RW trans was split
+    for (uint32_t t = 0; t < mRwNumTrans; t++) {
+        mRwTransRsp[t].pl_err = TAS_PL0_ERR_NO_ERROR;
+        mRwTransRsp[t].num_bytes_ok = 0;
+    }
 
+    // PL0 transactions of an RW transaction are consecutive and in address order
+    for (uint32_t p = 0; p < mPl0NumTrans; p++) {
+        uint32_t t = mPl0TrRwIdx[p];
+        assert(t < mRwNumTrans);
+        assert((p == 0) || (t == mPl0TrRwIdx[p - 1]) || (t == mPl0TrRwIdx[p - 1] + 1));
         if (mRwTransRsp[t].pl_err == TAS_PL0_ERR_NO_ERROR) {  // Only up to first error
             mRwTransRsp[t].pl_err = mPl0TransRsp[p].pl_err;
-            assert(mPl0TransRsp[p].num_bytes_ok <= mPl0Trans[p].num_bytes);
+            assert(mPl0TransRsp[p].num_bytes_ok <= mPl0TrNumBytes[p]);
             if (mPl0TransRsp[p].pl_err == TAS_PL0_ERR_NO_ERROR)
-                assert(mPl0TransRsp[p].num_bytes_ok == mPl0Trans[p].num_bytes);
+                assert(mPl0TransRsp[p].num_bytes_ok == mPl0TrNumBytes[p]);
             mRwTransRsp[t].num_bytes_ok += mPl0TransRsp[p].num_bytes_ok;
         }
-
-        if (addrNextPl0 >= addrEnd) {
-            assert(addrNextPl0 == addrEnd);
-            t++;
-            if (t == mRwNumTrans)
-                break;  // for p
-            mRwTransRsp[t].pl_err = TAS_PL0_ERR_NO_ERROR;
-            mRwTransRsp[t].num_bytes_ok = 0;
-        }
     }
 
     *trans_rsp = mRwTransRsp;
@@ -1208,7 +1745,20 @@ uint32_t CTasPktHandlerRw::rw_get_trans_rsp(const tas_rw_trans_rsp_st** trans_rs
 
 uint32_t CTasPktHandlerRw::rw_get_pl0_trans(const tas_rw_trans_st** pl0_trans, const tas_rw_trans_rsp_st** pl0_trans_rsp) const
 {
-    *pl0_trans     = mPl0Trans;
+    if (!mPl0Trans)
+        mPl0Trans.reset(new tas_rw_trans_st[mNumTransMax]);
+
+    for (uint32_t p = 0; p < mPl0NumTrans; p++) {
+        tas_rw_trans_st* pt = &mPl0Trans[p];
+        pt->addr = mPl0TrAddr[p];
+        pt->num_bytes = mPl0TrNumBytes[p];
+        pt->acc_mode = tphrPl0AttrAccMode(mPl0TrAttr[p]);
+        pt->addr_map = tphrPl0AttrAddrMap(mPl0TrAttr[p]);
+        pt->type = tphrPl0AttrType(mPl0TrAttr[p]);
+        pt->rdata = mPl0TrData[p];
+    }
+
+    *pl0_trans     = mPl0Trans.get();
     *pl0_trans_rsp = mPl0TransRsp;
     return mPl0NumTrans;
 }
@@ -1227,42 +1777,21 @@ void CTasPktHandlerRw::mSetPktRspErrPl0Data(uint8_t pl_err, tas_return_et tas_er
         return;  // Capture the first one
     }
     assert(mEip->info[0] == 0);
+    assert((tas_err == TAS_ERR_RW_READ) || (tas_err == TAS_ERR_RW_WRITE));
+    assert((pl_err == TAS_PL0_ERR_DATA) || (pl_err == TAS_PL0_ERR_DEV_LOCKED) || (pl_err == TAS_PL0_ERR_DEV_ACCESS) ||
+           (pl_err == TAS_PL0_ERR_ACC_MODE) || (pl_err == TAS_PL0_ERR_ADDR_MAP) || (pl_err == TAS_PL0_ERR_ADDR_BLOCKED));
 
-    const char* typeStr = (tas_err == TAS_ERR_RW_READ) ? "Read" : "Write";
-
-    std::array<char, 32> addrMapStr;
-    addrMapStr[0] = 0;
-    if (addr_map > 0)
-        snprintf(addrMapStr.data(), addrMapStr.size(), "in addr_map %d ", addr_map);
-
-    if (pl_err == TAS_PL0_ERR_DATA) {
-        assert((tas_err == TAS_ERR_RW_READ) || (tas_err == TAS_ERR_RW_WRITE));
-        mEip->tas_err = tas_err;
-        snprintf(mEip->info, TAS_INFO_STR_LEN, "ERROR: %s of addr %" PRIX64 " %sfailed", typeStr, addr, addrMapStr.data());
-    }
-    else if (pl_err == TAS_PL0_ERR_DEV_LOCKED) {
+    if (pl_err == TAS_PL0_ERR_DEV_LOCKED)
         mEip->tas_err = TAS_ERR_DEVICE_LOCKED;
-        snprintf(mEip->info, TAS_INFO_STR_LEN, "ERROR: Device is locked");
-    }
-    else if (pl_err == TAS_PL0_ERR_DEV_ACCESS) {
+    else if (pl_err == TAS_PL0_ERR_DEV_ACCESS)
         mEip->tas_err = TAS_ERR_DEVICE_ACCESS;
-        snprintf(mEip->info, TAS_INFO_STR_LEN, "ERROR: Device access failed");
-    }
-    else if (pl_err == TAS_PL0_ERR_ACC_MODE) {
-        mEip->tas_err = tas_err;
-        snprintf(mEip->info, TAS_INFO_STR_LEN, "ERROR: Set acc_mode not supported for %s of addr %" PRIX64 " %s", typeStr, addr, addrMapStr.data());
-    }
-    else if (pl_err == TAS_PL0_ERR_ADDR_MAP) {
-        mEip->tas_err = tas_err;
-        snprintf(mEip->info, TAS_INFO_STR_LEN, "ERROR: addr_map %d not supported", addr_map);
-    }
-    else if (pl_err == TAS_PL0_ERR_ADDR_BLOCKED) {
-        mEip->tas_err = tas_err;
-        snprintf(mEip->info, TAS_INFO_STR_LEN, "ERROR: %s of addr %" PRIX64 " %swas blocked", typeStr, addr, addrMapStr.data());
-    }
-    else {
+    else
         mEip->tas_err = tas_err;
-        snprintf(mEip->info, TAS_INFO_STR_LEN, "ERROR: %s of addr %" PRIX64 " %sreturned code 0x%2.2X", typeStr, addr, addrMapStr.data(), pl_err);
-        assert(false);
-    }
+
+    // The error info c-string is only rendered on demand by tas_get_error_info()
+    mEip->pending = TAS_EI_PENDING_PL0;
+    mEip->pl_err = pl_err;
+    mEip->trans_type = (tas_err == TAS_ERR_RW_READ) ? TAS_RW_TT_RD : TAS_RW_TT_WR;
+    mEip->addr = addr;
+    mEip->addr_map = addr_map;
 }
@@ -27,6 +27,16 @@
 
 // Standard includes
 
+//! \brief Packing figures of a transaction list with tight and with greedy PL2 packet packing
+typedef struct {
+	uint32_t num_pl2_pkt;			//!< \brief Number of PL2 packets with tight packing
+	uint32_t num_pl2_pkt_greedy;	//!< \brief Number of PL2 packets with greedy packing
+	uint32_t rq_num_bytes;			//!< \brief Size of all PL2 request packets with tight packing
+	uint32_t rq_num_bytes_greedy;	//!< \brief Size of all PL2 request packets with greedy packing
+	uint32_t rsp_num_bytes;			//!< \brief Predicted size of all PL2 response packets with tight packing
+	uint32_t rsp_num_bytes_greedy;	//!< \brief Predicted size of all PL2 response packets with greedy packing
+} tas_rw_pack_stats_st;
+
 //! \brief Derived packet handler class for handling read/write packets
 class CTasPktHandlerRw : public CTasPktHandlerBase
 {
@@ -34,6 +44,8 @@ class CTasPktHandlerRw : public CTasPktHandlerBase
 public:
 	CTasPktHandlerRw(const CTasPktHandlerRw&) = delete; //!< \brief delete the copy constructor
 	CTasPktHandlerRw operator= (const CTasPktHandlerRw&) = delete; //!< \brief delete copy-assignment operator
+	CTasPktHandlerRw(CTasPktHandlerRw&&) = default; //!< \brief default move constructor, the arena is taken over
+	CTasPktHandlerRw& operator= (CTasPktHandlerRw&&) = default; //!< \brief default move-assignment operator
 
 	//! \brief Read/write packet handler object constructor.
 	//! \details TasServer connection was established with CTasClientServerCon before.
@@ -43,7 +55,9 @@ public:
 	//! and the TAS frontend properties.
 	//! \param ei pointer to the TAS error info 
 	//! \param con_info pointer to the connection information
-	CTasPktHandlerRw(tas_error_info_st* ei, const tas_con_info_st* con_info);
+	//! \param arena optional caller-supplied memory of get_arena_size(PKT_BUF_SIZE_DEFAULT, MAX_NUM_RW_DEFAULT) bytes,
+	//! 8 byte aligned. Allocated internally if nullptr.
+	CTasPktHandlerRw(tas_error_info_st* ei, const tas_con_info_st* con_info, void* arena = nullptr);
 	
 	//! \brief Read/write packet handler object constructor. Used for testing and inside of TasServer.
 	//! \details Controls the allocated memory for packets and transaction descriptions.
@@ -51,10 +65,18 @@ public:
 	//! \param max_rq_size defines maximum size of request packets
 	//! \param max_rsp_size defines maximum size of response packets
 	//! \param max_num_rw defines maximum number of read/write transactions
-	CTasPktHandlerRw(tas_error_info_st* ei, uint32_t max_rq_size, uint32_t max_rsp_size, uint32_t max_num_rw);
-
-	//! \brief Packet handler object destructor for cleanup.
-	~CTasPktHandlerRw();
+	//! \param arena optional caller-supplied memory of get_arena_size(max_rq_size, max_num_rw) bytes, 8 byte aligned.
+	//! Allocated internally if nullptr.
+	CTasPktHandlerRw(tas_error_info_st* ei, uint32_t max_rq_size, uint32_t max_rsp_size, uint32_t max_num_rw, void* arena = nullptr);
+
+	//! \brief Get the size of the memory arena which holds the request buffer and all transaction lists.
+	//! \details The arena is a single block of\n
+	//! max_rq_size + max_num_rw * (66 + 2 * sizeof(void*)) bytes\n
+	//! with each of the lists rounded up to a multiple of 8 bytes. The response buffer is owned by the caller.
+	//! \param max_rq_size maximum size of request packets
+	//! \param max_num_rw maximum number of read/write transactions
+	//! \returns the arena size in bytes, a multiple of 8
+	static size_t get_arena_size(uint32_t max_rq_size, uint32_t max_num_rw);
 
 	// This API assumes a usage where:
 	// Normally all transactions are successful
@@ -74,6 +96,7 @@ public:
 	//! \param acc_mode access mode to be used, default: 0
 	//! \param addr_map address map to be used, default: 0
 	//! \returns \c true on success, otherwise \c false and does not add the transaction if the limits (default or set by constructor) are violated
+	//! or num_bytes exceeds \ref MAX_NUM_BYTES_RW
 	bool rw_add_rd(uint64_t addr, uint32_t num_bytes,       void* data, uint16_t acc_mode = 0, uint8_t addr_map = 0);
 
 	//! \brief Add a write transaction. It can result in multiple PL0 packets in case of unaligned address.
@@ -83,6 +106,7 @@ public:
 	//! \param acc_mode access mode to be used, default: 0
 	//! \param addr_map address map to be used, default: 0
 	//! \returns \c true on success, otherwise \c false and does not add the transaction if the limits (default or set by constructor) are violated
+	//! or num_bytes exceeds \ref MAX_NUM_BYTES_RW
 	bool rw_add_wr(uint64_t addr, uint32_t num_bytes, const void* data, uint16_t acc_mode = 0, uint8_t addr_map = 0);
 
 	//! \brief Add a fill transaction. It can result in multiple PL0 packets in case of unaligned address.
@@ -102,6 +126,34 @@ public:
 	//! \returns \c true on success, otherwise \c false and if limits (default or set by constructor) are violated. No packets are created in this case.
 	bool rw_set_trans(const tas_rw_trans_st* trans, uint32_t num_trans = 1);
 
+	//! \brief Add a list of transactions with tight PL2 packet packing.
+	//! \details Same as \ref rw_set_trans but each PL2 packet is filled up to the connection limits.
+	//! Since the transaction order is kept, filling each packet completely and splitting block transfers exactly
+	//! at the packet boundary results in the minimum number of PL2 packets. The packing mode set by
+	//! \ref rw_set_pack_tight is not changed.
+	//! \param trans pointer to a list of transactions
+	//! \param num_trans number of transactions in the list
+	//! \param stats optional pointer to packing figures. If not nullptr the list is additionally encoded with
+	//! greedy packing for comparison.
+	//! \returns \c true on success, otherwise \c false and if limits are violated. No packets are created in this case.
+	bool rw_set_trans_packed(const tas_rw_trans_st* trans, uint32_t num_trans, tas_rw_pack_stats_st* stats = nullptr);
+
+	//! \brief Select the PL2 packet packing of subsequently added transactions.
+	//! \details Greedy packing (default) starts a new PL2 packet as soon as the remaining space is below a
+	//! heuristic reserve, so that small block transfers are not split. Tight packing fills each PL2 packet
+	//! up to the connection limits and splits block transfers exactly at the packet boundary.
+	//! Transactions with address maps >= TAS_AM12 are never split in both modes.
+	//! \param enable \c true for tight packing, \c false for greedy packing
+	void rw_set_pack_tight(bool enable) { mPackTight = enable; }
+
+	//! \brief Add transactions of a list until the limits are reached.
+	//! \details Can be called after \ref rw_start or other added transactions. Transactions which do not fit anymore
+	//! are not added. The added transactions are the first ones of the list.
+	//! \param trans pointer to a list of transactions
+	//! \param num_trans number of transactions in the list
+	//! \returns the number of added transactions
+	uint32_t rw_add_trans(const tas_rw_trans_st* trans, uint32_t num_trans);
+
 	//! \brief Get a request size.
 	//! \returns the size of all PL2 request packets
 	uint32_t rw_get_rq_size() const;  
@@ -118,6 +170,37 @@ public:
 	//! \param rsp_num_bytes_max pointer to the maximum response length in bytes
 	//! \param num_pl2_pkt pointer to the number of pl2 packets
 	void rw_get_rq(const uint32_t** rq, uint32_t* rq_num_bytes, uint32_t* rsp_num_bytes_max, uint32_t* num_pl2_pkt);
+
+	//! \brief Re-arm the already finalized request packet(s) for another execution.
+	//! \details Only valid after \ref rw_get_rq. The encoding, the PL2 packet layout and the predicted response size are kept.
+	//! Only the write payloads are copied again from the data buffers which were passed when the transactions were added,
+	//! and the PL1 counters of all PL2 packets are renewed. Fill values are not updated.
+	//! With the first call a response parse plan is compiled. \ref rw_set_rsp uses it for a fast path as long as
+	//! the response has the expected layout and no errors.
+	//! \param rq pointer to the request
+	//! \param rq_num_bytes pointer to the length of the request in bytes
+	//! \param rsp_num_bytes_max pointer to the maximum response length in bytes
+	//! \param num_pl2_pkt pointer to the number of pl2 packets
+	void rw_rearm_rq(const uint32_t** rq, uint32_t* rq_num_bytes, uint32_t* rsp_num_bytes_max, uint32_t* num_pl2_pkt);
+
+	//! \brief Set a single read or write transaction and get the request packet.
+	//! \details Replaces the sequence \ref rw_set_trans and \ref rw_get_rq for a single transaction.
+	//! Naturally aligned 1, 2, 4 or 8 byte accesses are kept as request template. If the next access has the same type,
+	//! size, access mode, address map and base address command, only the address, write data and PL1 counter are
+	//! patched and the response is checked with the response parse plan.
+	//! \param trans pointer to the transaction
+	//! \param rq pointer to the request
+	//! \param rq_num_bytes pointer to the length of the request in bytes
+	//! \param rsp_num_bytes_max pointer to the maximum response length in bytes
+	//! \param num_pl2_pkt pointer to the number of pl2 packets
+	//! \returns \c true on success, otherwise \c false if limits are violated. No packets are created in this case.
+	bool rw_set_trans_single(const tas_rw_trans_st* trans, const uint32_t** rq, uint32_t* rq_num_bytes, uint32_t* rsp_num_bytes_max, uint32_t* num_pl2_pkt);
+
+	//! \brief Get the limits which were set by the constructor.
+	//! \param max_rq_size pointer to the maximum size of request packets
+	//! \param max_rsp_size pointer to the maximum size of response packets
+	//! \param max_num_rw pointer to the maximum number of read/write transactions
+	void rw_get_limits(uint32_t* max_rq_size, uint32_t* max_rsp_size, uint32_t* max_num_rw) const;
 	
 	//! \brief Get a number of PL2 packets in a response.
 	//! \details Check if received response contains already all PL2 packets.
@@ -133,6 +216,25 @@ public:
 	//! \param num_bytes length of a response in bytes
 	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code 
 	tas_return_et rw_set_rsp(const uint32_t* rsp, uint32_t num_bytes);
+
+	//! \brief Start the incremental parsing of the response packets with \ref rw_set_rsp_pl2.
+	void rw_set_rsp_begin();
+
+	//! \brief Set the next received response PL2 packet.
+	//! \details Incremental alternative to \ref rw_set_rsp. Each PL2 packet is validated and its read data is stored
+	//! as soon as it is received, while the following packets are still in transit.
+	//! The response of the request is complete when all PL2 packets were set.
+	//! \param rsp pointer to the PL2 packet
+	//! \param num_bytes length of the PL2 packet in bytes
+	//! \returns \ref TAS_ERR_NONE on success, \ref TAS_ERR_RW_READ or \ref TAS_ERR_RW_WRITE if a transaction of this or an
+	//! earlier packet failed, otherwise any other relevant TAS error code. In the latter case the parsing cannot be continued.
+	tas_return_et rw_set_rsp_pl2(const uint32_t* rsp, uint32_t num_bytes);
+
+	//! \brief Get the number of transactions for which the response was completely parsed.
+	//! \details The transactions are completed in the order in which they were added. Useful for pipelined consumers
+	//! of the read data together with \ref rw_set_rsp_pl2.
+	//! \returns the number of completed RW transactions
+	uint32_t rw_get_num_trans_done() const;
 	
 	//! \brief Get a response form transactions.
 	//! \details This method is for individual error handling or debugging.
@@ -146,12 +248,38 @@ public:
 	//! \returns the number of transactions on PL0 level
 	uint32_t rw_get_pl0_trans(const tas_rw_trans_st** pl0_trans, const tas_rw_trans_rsp_st** pl0_trans_rsp) const;
 
+	//! \brief Get the number of PL0 transactions of the current request.
+	//! \returns the number of PL0 transactions
+	uint32_t rw_get_num_pl0_trans() const { return mPl0NumTrans; }
+
+	//! \brief Kernels for the validation of the response headers of a precomputed response plan
+	enum tas_rsp_hdr_kernel_et {
+		RSP_HDR_KERNEL_SCALAR,	//!< \brief portable scalar kernel
+		RSP_HDR_KERNEL_AVX2,	//!< \brief AVX2 kernel with gathered loads, x86 only
+	};
+
+	//! \brief Check if a header validation kernel can be used with this build and CPU.
+	//! \param kernel header validation kernel
+	//! \returns \c true if the kernel is supported, otherwise \c false
+	static bool rsp_hdr_kernel_supported(tas_rsp_hdr_kernel_et kernel);
+
+	//! \brief Compare response header words against their expected values with a specific kernel.
+	//! \details The packet handler selects the kernel itself at runtime. This method is only for benchmarking.
+	//! \param kernel header validation kernel, has to be supported
+	//! \param rsp pointer to the response words
+	//! \param wi pointer to the word indices of the headers in rsp
+	//! \param hdr pointer to the expected header words
+	//! \param num number of headers
+	//! \returns \c true if all headers match, otherwise \c false
+	static bool rsp_hdr_match(tas_rsp_hdr_kernel_et kernel, const uint32_t* rsp, const uint32_t* wi, const uint32_t* hdr, uint32_t num);
+
 	//! \brief Default limits.
 	//! \details  Limits are for all generated PL2 packets together.
 	enum {
 		PKT_BUF_SIZE_DEFAULT = 0x10000,	//!< \brief default packet buffer size
 		MAX_NUM_RW_DEFAULT = 256,		//!< \brief default maximum number of read/write transactions
 		BUF_ALLOWANCE = 64,				//!< \brief buffer allowance for overhead
+		MAX_NUM_BYTES_RW = 0xFFFF,		//!< \brief maximum size of a read or write transaction, see tas_rw_trans_rsp_st::num_bytes_ok
 	}; 
 
 private:
@@ -160,7 +288,8 @@ private:
 	//! \param max_rq_size maximum size of a request packet in bytes
 	//! \param max_rsp_size maximum size of a response packet in bytes
 	//! \param max_num_rw maximum number of read/write transactions
-	void mInit(uint32_t max_rq_size, uint32_t max_rsp_size, uint32_t max_num_rw);
+	//! \param arena memory of get_arena_size() bytes or nullptr
+	void mInit(uint32_t max_rq_size, uint32_t max_rsp_size, uint32_t max_num_rw, void* arena);
 
 	void mEnforceDerivedClass() { ; }
 
@@ -198,6 +327,14 @@ private:
 	//! \param add_map selected address map
 	void mPktAdd_Fill(uint64_t addr, uint32_t num_bytes, uint64_t value, uint16_t acc_mode, uint8_t addr_map);
 
+	//! \brief Record a PL0 transaction of the current RW transaction in the PL0 bookkeeping arrays.
+	//! \param addr target address
+	//! \param num_bytes number of bytes of the PL0 transaction
+	//! \param type transaction type
+	//! \param data read data destination, write data source or fill value in the request
+	//! \param rq_data_wi word index of the write payload in the request, 0 if it is not re-armed
+	void mPl0TransAdd(uint64_t addr, uint32_t num_bytes, tas_rw_trans_type_et type, void* data, uint32_t rq_data_wi);
+
 	//! \brief Check if a read/write transaction can be added to the request without overflowing the response buffer.
 	//! \param num_bytes_needed_pktrq number of bytes needed in the request buffer for the transaction in question
 	//! \param num_bytes_needed_pktrsp number of bytes needed in the response buffer for the transaction in question
@@ -258,6 +395,14 @@ private:
 	//! \returns \c true if adding the request would not exceed the maximum number of read/write transactions, otherwise \c false
 	bool mNumTransManageableWr(uint64_t addr, uint32_t num_bytes) const;
 
+	//! \brief Get the maximum number of PL0 transactions a read or write request can be split into.
+	//! \details Counts the unaligned head and tail, the blocks and one shortened block for each PL2 packet boundary.
+	//! \param type transaction type, read or write
+	//! \param addr target address
+	//! \param num_bytes number of bytes to be read or written
+	//! \returns the worst case number of PL0 transactions
+	uint32_t mGetNumPl0TransMax(tas_rw_trans_type_et type, uint64_t addr, uint32_t num_bytes) const;
+
 	//! \brief Get the remaining available space in a request packet.
 	//! \returns the size of remaining space in [bytes]
 	uint32_t mGetRemainingSizeInPktRq() const;
@@ -277,6 +422,47 @@ private:
 	//! \returns the size of a block in [bytes]
 	uint32_t mGetRdDataBlkSizeInPktRsp(uint32_t num_bytes) const;
 
+	//! \brief Get the size of the next block transfer with tight packing.
+	//! \details Accounts exactly for the address map, access mode and base address PL0 packets which are still needed.
+	//! Starts a new PL2 packet if not even 8 bytes fit into the current one.
+	//! \param type \ref TAS_RW_TT_RD or \ref TAS_RW_TT_WR
+	//! \param addr target address, 64 bit aligned
+	//! \param num_bytes number of bytes still to be transferred, >= 8
+	//! \param acc_mode chosen access mode
+	//! \param addr_map chosen address map
+	//! \returns the size of a block in [bytes], multiple of 8
+	uint32_t mGetDataBlkSizeTight(tas_rw_trans_type_et type, uint64_t addr, uint32_t num_bytes, uint16_t acc_mode, uint8_t addr_map);
+
+	//! \brief Compile the response parse plan from the finalized request packets.
+	//! \details The plan holds the expected header word, position and read data destination of each PL0 response
+	//! for a response without errors.
+	void mCompileRspPlan();
+
+	//! \brief Fast path for the next response PL2 packet based on the response parse plan.
+	//! \details Only compares the header words and copies the read data. Any mismatch needs the full validating parser.
+	//! Nothing is stored if the packet does not match the plan.
+	//! \param rsp pointer to the PL2 packet
+	//! \param num_bytes length of the PL2 packet in bytes
+	//! \returns \c true if the packet matched the plan, otherwise \c false
+	bool mSetRspPl2ByPlan(const uint32_t* rsp, uint32_t num_bytes);
+
+	//! \brief Parse the next response PL2 packet with the plan or, if it does not match, with \ref mSetRspPl2.
+	//! \param rsp pointer to the PL2 packet
+	//! \param num_bytes length of the PL2 packet in bytes
+	//! \returns \c true if the packet could be parsed, otherwise \c false with a protocol error in the error info
+	bool mSetRspPl2Next(const uint32_t* rsp, uint32_t num_bytes);
+
+	//! \brief Parse a single response PL2 packet.
+	//! \details PL0 errors are captured in the error info and the parsing continues.
+	//! \param rsp pointer to the PL2 packet
+	//! \param num_bytes length of the PL2 packet in bytes
+	//! \returns \c true if the packet could be parsed, otherwise \c false with a protocol error in the error info
+	bool mSetRspPl2(const uint32_t* rsp, uint32_t num_bytes);
+
+	//! \brief Set the connection protocol error for \ref mSetRspPl2.
+	//! \returns \c false
+	bool mSetRspPl2Failed();
+
 	//! \brief Set server connection error in case of a PL1 count mismatch.
 	//! \returns \ref TAS_ERR_SERVER_CON
 	tas_return_et mSetPktRspErrPl1Cnt();
@@ -310,18 +496,64 @@ private:
 	uint64_t mPl0BaseAddr;		//!< \brief Target base address for the current set of PL0 packets
 
 	// Transactions on API level, determined by caller
-	tas_rw_trans_st* mRwTrans;	//!< \brief Pointer to an internal list of transactions, used for packet building
 	tas_rw_trans_rsp_st* mRwTransRsp;	//!< \brief Pointer to an internal list of transaction responses
-	uint32_t mRwNumTrans;   //!< \brief Used as index for mRwTrans[] and mRwTransRsp[]
-
-	// Resulting transactions on PL0 level
-	tas_rw_trans_st* mPl0Trans;	//!< \brief Pointer to an internal list of PL0 transactions
+	uint32_t mRwNumTrans;   //!< \brief Used as index for mRwTransRsp[]
+
+	// Resulting transactions on PL0 level as structure of arrays. The response parsing and
+	// the re-arming of a request only touch the arrays they need.
+	uint64_t* mPl0TrAddr;		//!< \brief Address of each PL0 transaction
+	uint16_t* mPl0TrNumBytes;	//!< \brief Number of bytes of each PL0 transaction, <= TAS_PL0_DATA_BLK_SIZE
+	uint32_t* mPl0TrAttr;		//!< \brief Type, address map and access mode of each PL0 transaction packed into one word
+	void**    mPl0TrData;		//!< \brief Read data destination or write data source of each PL0 transaction
+	uint32_t* mPl0TrRwIdx;		//!< \brief Index of the RW transaction to which each PL0 transaction belongs
 	tas_rw_trans_rsp_st* mPl0TransRsp;	//! \brief Pointer to an internal list of PL0 transaction responses
-	uint32_t mPl0NumTrans;   //!< \brief Number of PL0 transactions. Used also as index for mPl0Trans[] and mPl0TransRsp[]
+	uint32_t mPl0NumTrans;   //!< \brief Number of PL0 transactions. Used also as index for the mPl0Tr*[] arrays and mPl0TransRsp[]
+	uint32_t* mPl0RqDataWi;	//!< \brief Word index of the write payload in mRqBuf for each PL0 transaction. 0 if there is none.
+	std::unique_ptr<uint64_t[]> mArenaOwned;	//!< \brief Internally allocated arena, nullptr if the arena was supplied by the caller
+	mutable std::unique_ptr<tas_rw_trans_st[]> mPl0Trans;	//!< \brief PL0 transactions as array of structures, only built by rw_get_pl0_trans()
 
 	uint32_t mNumTransMax;  //!< \brief mRwNumTrans <= mPl0NumTrans
 
+	bool mPackTight = false;  //!< \brief Fill PL2 packets up to the connection limits instead of keeping a reserve
+
 	bool mGetPktRqWasCalled; //!< \brief Flag to indicated whether get a request method was called or not 
+
+	uint32_t mRspPl0Idx = 0;  //!< \brief Index of the next PL0 transaction in the response which is parsed
+	uint32_t mRspPl2Idx = 0;  //!< \brief Index of the next PL2 packet in the response which is parsed
+
+	//! \brief Entry of the response parse plan for a PL2 packet
+	typedef struct {
+		uint32_t num_bytes;	//!< \brief Expected PL2 packet length
+		uint32_t pl0_first;	//!< \brief First PL0 transaction and header in the packet
+		uint32_t pl0_end;	//!< \brief PL0 transaction after the last one in the packet
+		uint32_t rd_first;	//!< \brief First entry in mRspPlanRd of the packet
+		uint32_t rd_end;	//!< \brief Entry in mRspPlanRd after the last one of the packet
+	} tas_rsp_plan_pl2_st;
+
+	//! \brief Entry of the response parse plan for a read transaction
+	typedef struct {
+		uint32_t wi;		//!< \brief Word index of the PL0 header in the PL2 response packet
+		uint32_t num_bytes;	//!< \brief Number of read data bytes to be copied
+		void*    rdata;		//!< \brief Destination of the read data
+	} tas_rsp_plan_rd_st;
+
+	// Response parse plan in the arena with max_num_rw entries each. It is applied to each PL2 packet separately,
+	// so word indices are relative to the start of the PL2 packet. Headers are kept as separate arrays for bulk validation.
+	tas_rsp_plan_pl2_st* mRspPlanPl2;	//!< \brief PL2 packets of the response
+	uint32_t* mRspPlanHdrWi;			//!< \brief Word index of each PL0 response header
+	uint32_t* mRspPlanHdr;				//!< \brief Expected PL0 response header word if no error
+	tas_rsp_plan_rd_st* mRspPlanRd;		//!< \brief Read data to be copied from the response
+	uint32_t mRspPlanNumPl2;			//!< \brief Number of entries in mRspPlanPl2
+	uint32_t mRspPlanNumHdr;			//!< \brief Number of entries in mRspPlanHdrWi and mRspPlanHdr
+	uint32_t mRspPlanNumRd;				//!< \brief Number of entries in mRspPlanRd
+	bool mRspPlanValid;	//!< \brief Flag to indicate that the response parse plan matches the current request
+
+	// Single access request template of rw_set_trans_single()
+	bool mSingleValid;				//!< \brief Flag to indicate that the request buffer holds a single access template
+	uint8_t  mSingleAddrMap;		//!< \brief Address map of the single access template on API level
+	uint32_t mSingleBaseAddrClass;	//!< \brief 0: no base address command, 1: BASE_ADDR32, 2: BASE_ADDR64
+	uint32_t mSingleWiBaseAddr;		//!< \brief Word index of the base address command
+	uint32_t mSingleWiCmd;			//!< \brief Word index of the read or write command
 };
 
 //! \} // end of group Packet_Handlers_RW
\ No newline at end of file
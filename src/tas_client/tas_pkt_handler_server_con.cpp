@@ -34,20 +34,19 @@ CTasPktHandlerServerCon::CTasPktHandlerServerCon(tas_error_info_st* ei)
 
 	mSessionName[0] = '\0';
 
+	mTargetInfo.reserve(NUM_TARGET_RESERVE);
+	mTargetClientInfo.reserve(NUM_TARGET_CLIENT_RESERVE);
+
 	mPl1CntOutstandingLast = 0xFFC0;  // Enforce early overrun in test setups
 
 	// From CTasPktHandlerBase, allocated and set here in the derived class:
 	mMaxRqSize = MAX_PKT_RQ_SIZE + 64;
-	mRqBuf = new uint32_t[mMaxRqSize / 4];
+	mRqBufOwned.reset(new uint32_t[mMaxRqSize / 4]);
+	mRqBuf = mRqBufOwned.get();
 	mRqWiMax = mMaxRqSize / 4;
 	mMaxRspSize = MAX_PKT_RSP_SIZE;
 }
 
-CTasPktHandlerServerCon::~CTasPktHandlerServerCon()
-{
-	delete[] mRqBuf;
-}
-
 const uint32_t* CTasPktHandlerServerCon::get_pkt_rq_server_connect(const char* client_name, const char* user_name, uint32_t client_pid)
 {
 	const uint32_t pl1PktSize = sizeof(tas_pl1rq_server_connect_st);
@@ -135,7 +134,7 @@ tas_return_et CTasPktHandlerServerCon::set_pkt_rsp_get_targets(const uint32_t* p
 	*num_target = *num_now = 0;
 
 	if (mStartIndex == 0) {
-		mNumTarget = 0;
+		mTargetInfo.clear();
 	}
 
 	assert(pkt_rsp[0] < MAX_PKT_RSP_SIZE - 64);
@@ -152,23 +151,21 @@ tas_return_et CTasPktHandlerServerCon::set_pkt_rsp_get_targets(const uint32_t* p
 		return mSetPktRspErrConnectionProtocol();
 	}
 	else if ( (pkt->start_index != mStartIndex) ||
-			  ((mStartIndex > 0) && (mNumTarget < NUM_TARGET_MAX) && (pkt->num_target != mNumTarget))) {
+			  ((mStartIndex > 0) && (pkt->num_target != (uint32_t)mTargetInfo.size()))) {
 		return mSetPktRspErrConnectionProtocol();
 	}
-	else if ((pkt->start_index != 0) && (((uint32_t)pkt->start_index + pkt->num_now) > mNumTarget)) {
+	else if ((((uint32_t)pkt->start_index + pkt->num_now) > pkt->num_target) ||
+			 ((pkt->num_now == 0) && (pkt->start_index < pkt->num_target) && (pkt->err == TAS_PL_ERR_NO_ERROR))) {
 		return mSetPktRspErrConnectionProtocol();
 	}
 	else {
 		if (pkt->err == TAS_PL_ERR_NO_ERROR) {
 			if (mStartIndex == 0) {
-				mNumTarget = pkt->num_target;
-				if (mNumTarget > NUM_TARGET_MAX) {
-					assert(false);
-					mNumTarget = NUM_TARGET_MAX;
-				}
+				mTargetInfo.resize(pkt->num_target);  // No reallocation if the capacity of a previous list suffices
 			}
-			memcpy(&mTargetInfo[mStartIndex], &pkt_rsp[3], pkt->num_now * sizeof(tas_target_info_st));
-			*num_target = mNumTarget;
+			if (pkt->num_now > 0)
+				memcpy(&mTargetInfo[mStartIndex], &pkt_rsp[3], pkt->num_now * sizeof(tas_target_info_st));
+			*num_target = pkt->num_target;
 			*num_now = pkt->num_now;
 			return tas_clear_error_info(mEip);
 		}
@@ -182,8 +179,8 @@ tas_return_et CTasPktHandlerServerCon::set_pkt_rsp_get_targets(const uint32_t* p
 
 void CTasPktHandlerServerCon::get_target_info(const tas_target_info_st** target_info, uint32_t* num_target) const
 {
-	*target_info = (mNumTarget > 0) ? mTargetInfo.data() : nullptr;
-	*num_target = mNumTarget;
+	*target_info = (!mTargetInfo.empty()) ? mTargetInfo.data() : nullptr;
+	*num_target = (uint32_t)mTargetInfo.size();
 }
 
 const uint32_t* CTasPktHandlerServerCon::get_pkt_rq_get_target_clients(const char* identifier, uint8_t start_index)
@@ -208,7 +205,7 @@ tas_return_et CTasPktHandlerServerCon::set_pkt_rsp_get_target_clients(const uint
 	if (mStartIndex == 0) {
 		mSessionName[0] = '\0';
 		mSessionStartTimeUs = 0;
-		mNumTargetClient = 0;
+		mTargetClientInfo.clear();
 	}
 
 	auto pkt = (const tas_pl1rsp_get_clients_st*)&pkt_rsp[1];
@@ -224,10 +221,11 @@ tas_return_et CTasPktHandlerServerCon::set_pkt_rsp_get_target_clients(const uint
 		return mSetPktRspErrConnectionProtocol();
 	}
 	else if ((pkt->start_index != mStartIndex) ||
-		((mStartIndex > 0) && (mNumTargetClient < NUM_TARGET_CLIENT_MAX) && (pkt->num_client != mNumTargetClient))) {
+		((mStartIndex > 0) && (pkt->num_client != (uint32_t)mTargetClientInfo.size()))) {
 		return mSetPktRspErrConnectionProtocol();
 	}
-	else if ((pkt->start_index != 0) && (((uint32_t)pkt->start_index + pkt->num_now) > mNumTargetClient)) {
+	else if ((((uint32_t)pkt->start_index + pkt->num_now) > pkt->num_client) ||
+			 ((pkt->num_now == 0) && (pkt->start_index < pkt->num_client) && (pkt->err == TAS_PL_ERR_NO_ERROR))) {
 		return mSetPktRspErrConnectionProtocol();
 	}
 	else {
@@ -235,14 +233,13 @@ tas_return_et CTasPktHandlerServerCon::set_pkt_rsp_get_target_clients(const uint
 			if (mStartIndex == 0) {
 				snprintf(mSessionName.data(), TAS_NAME_LEN16, "%s", pkt->session_name);
 				mSessionStartTimeUs = pkt->session_start_time_us;
-				mNumTargetClient = pkt->num_client;
-				if (mNumTargetClient > NUM_TARGET_CLIENT_MAX) {
-					assert(false);
-					mNumTargetClient = NUM_TARGET_CLIENT_MAX;
-				}
+				mTargetClientInfo.resize(pkt->num_client);  // No reallocation if the capacity of a previous list suffices
 			}
 			int wiTciStart = (4 + sizeof(tas_pl1rsp_get_clients_st)) / 4;
-			memcpy(mTargetClientInfo.data(), &pkt_rsp[wiTciStart], pkt->num_now * sizeof(tas_target_client_info_st));
+			if (pkt->num_now > 0)
+				memcpy(&mTargetClientInfo[mStartIndex], &pkt_rsp[wiTciStart], pkt->num_now * sizeof(tas_target_client_info_st));
+			*num_client = pkt->num_client;
+			*num_now = pkt->num_now;
 			return tas_clear_error_info(mEip);
 		}
 		else if (pkt->err == TAS_PL_ERR_PARAM) {
@@ -269,11 +266,11 @@ int ttci_compare_by_connect_time(const void* _tcci0, const void* _tcci1)
 void CTasPktHandlerServerCon::get_target_clients_info(const char** session_name, uint64_t* session_start_time_us,
 	const tas_target_client_info_st** target_client_info, uint32_t* num_client)
 {
-	qsort(mTargetClientInfo.data(), mNumTargetClient, sizeof(tas_target_client_info_st), ttci_compare_by_connect_time);
+	qsort(mTargetClientInfo.data(), mTargetClientInfo.size(), sizeof(tas_target_client_info_st), ttci_compare_by_connect_time);
 
 	*session_name = mSessionName.data();
 	*session_start_time_us = mSessionStartTimeUs;
-	*num_client = mNumTargetClient;
+	*num_client = (uint32_t)mTargetClientInfo.size();
 	*target_client_info = mTargetClientInfo.data();
 }
 
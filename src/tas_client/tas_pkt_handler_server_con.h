@@ -28,6 +28,7 @@
 
 // Standard includes
 #include <array>
+#include <vector>
 
 //! \brief Derived packet handler class for handling client-server packets
 class CTasPktHandlerServerCon : public CTasPktHandlerBase
@@ -41,8 +42,12 @@ public:
 	//! \param ei pointer to the TAS error info 
 	explicit CTasPktHandlerServerCon(tas_error_info_st* ei);
 
-	//! \brief Packet handler object destructor for cleanup.
-	~CTasPktHandlerServerCon();
+	CTasPktHandlerServerCon(CTasPktHandlerServerCon&&) = default; //!< \brief default move constructor
+	CTasPktHandlerServerCon& operator= (CTasPktHandlerServerCon&&) = default; //!< \brief default move-assignment operator
+
+	//! \brief Get the server information buffer which is filled by \ref set_pkt_rsp_server_connect()
+	//! \returns pointer to the server information
+	const tas_server_info_st* get_server_info() const { return &mServerInfo; }
 
 	//! \brief Get a request packet for establishing a connection with a server.
 	//! \param client_name pointer to a c-string containing the client's name
@@ -86,6 +91,10 @@ public:
 	//! \param num_target pointer to the number of targets
 	void  get_target_info(const tas_target_info_st** target_info, uint32_t* num_target) const;
 
+	//! \brief Get the part of the target list which was received with the last get targets response.
+	//! \returns pointer to the first target of the response
+	const tas_target_info_st* get_target_info_page() const { return mTargetInfo.data() + mStartIndex; }
+
 	//! \brief Get a request for retrieving a list of clients connected to a target.
 	//! \param identifier pointer to a c-string containing the target's identifier
 	//! \param start_index indicates the first position in the list
@@ -107,6 +116,18 @@ public:
 	void  get_target_clients_info(const char** session_name, uint64_t* session_start_time_us,
 								  const tas_target_client_info_st** target_client_info, uint32_t* num_client);
 
+	//! \brief Get the part of the client list which was received with the last get target clients response.
+	//! \details In contrast to \ref get_target_clients_info() the list is not sorted.
+	//! \param session_name pointer to a c-string containing the session name
+	//! \param session_start_time_us pointer to the value when the session was started
+	//! \returns pointer to the first client of the response
+	const tas_target_client_info_st* get_target_clients_info_page(const char** session_name, uint64_t* session_start_time_us) const
+	{
+		*session_name = mSessionName.data();
+		*session_start_time_us = mSessionStartTimeUs;
+		return mTargetClientInfo.data() + mStartIndex;
+	}
+
 	//! \brief Get a request for a session start.
 	//! \param client_type specifies the type of a client: RW, CHL, TRC
 	//! \param identifier Unique access HW name or IP address of device as a c-string
@@ -176,8 +197,8 @@ private:
 	enum {
 		MAX_PKT_RQ_SIZE  = 1024,	//!< \brief Maximum size of a request packet
 		MAX_PKT_RSP_SIZE = 1024,	//!< \brief Maximum size of a response packet
-		NUM_TARGET_MAX = 64,		//!< \brief Maximum length of the list containing targets' information
-		NUM_TARGET_CLIENT_MAX = 32,	//!< \brief Maximum length of the list containing clients' information connected to a target
+		NUM_TARGET_RESERVE = 64,		//!< \brief Initial capacity of the list containing targets' information
+		NUM_TARGET_CLIENT_RESERVE = 32,	//!< \brief Initial capacity of the list containing clients' information connected to a target
 	};
 
 	void mEnforceDerivedClass() { ; }
@@ -201,14 +222,14 @@ private:
 	tas_server_info_st mServerInfo = {};				//!< \brief Server's information buffer
 	uint64_t mServerChallenge = 0;						//!< \brief Server's challenge value 
 
-	std::array<tas_target_info_st, NUM_TARGET_MAX> mTargetInfo;	//!< \brief List of target informations
-	uint32_t mNumTarget = 0;									//!< \brief number of targets in the list <= \ref NUM_TARGET_MAX
+	//! \brief List of target informations. Sized with the first page, the capacity is kept for the next lists.
+	std::vector<tas_target_info_st> mTargetInfo;
 
 	std::array<char, TAS_NAME_LEN16> mSessionName;	//!< \brief Buffer for the session name c-string
 	uint64_t mSessionStartTimeUs;					//!< \brief Session start time in microseconds
 
-	std::array<tas_target_client_info_st, NUM_TARGET_CLIENT_MAX> mTargetClientInfo;	//!< \brief List of client informations for clients which are connected to a target
-	uint32_t mNumTargetClient = 0;													//!< \brief number of clients in the list <= \ref NUM_TARGET_CLIENT_MAX
+	//! \brief List of client informations for clients which are connected to a target. Sized like mTargetInfo.
+	std::vector<tas_target_client_info_st> mTargetClientInfo;
 
 	uint8_t mStartIndex;	//!< \brief Local copy of the start index for any of the lists
 };
@@ -43,6 +43,11 @@ public:
 	//! \returns \c true if yes, otherwise \c false
 	virtual bool connected() = 0;
 
+	//! \brief Check without blocking if an idle connection is still established.
+	//! \details Must only be called when no response is outstanding. Default is \ref connected().
+	//! \returns \c true if yes, otherwise \c false
+	virtual bool connected_idle() { return connected(); }
+
 	//! \brief Send out a request packet.
 	//! \details The method call is blocking until all PL2 packets have been sent.
 	//! \param rq pointer to a request packet buffer, can contain more than one PL2 defined by the num_pl2_pkt value
@@ -0,0 +1,429 @@
+/*
+ *  Copyright (c) 2024 Infineon Technologies AG.
+ *
+ *  This file is part of TAS Client, an API for device access for Infineon's 
+ *  automotive MCUs. 
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *  **************************************************************************************************************** */
+// TAS includes
+#include "tas_pkt_mailbox_mux.h"
+#include "tas_pkt.h"
+#include "tas_utils.h"
+
+// Standard includes
+#include <cassert>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+CTasPktMailboxMuxSession::CTasPktMailboxMuxSession(CTasPktMailboxMux* mux, uint8_t con_id)
+	: mMux(mux), mConId(con_id)
+{
+
+}
+
+CTasPktMailboxMuxSession::~CTasPktMailboxMuxSession()
+{
+	std::lock_guard<std::mutex> lock(mMux->mMutex);
+	mMux->mSession[mConId] = nullptr;
+	// Late responses in request order are drained and dropped
+	std::replace(mMux->mOrderConId.begin(), mMux->mOrderConId.end(), mConId, (uint8_t)CTasPktMailboxMux::CON_ID_NONE);
+	if (mMux->mChlConId == mConId)
+		mMux->mChlConId = CTasPktMailboxMux::CON_ID_NONE;
+	if (mMux->mTrcConId == mConId)
+		mMux->mTrcConId = CTasPktMailboxMux::CON_ID_NONE;
+}
+
+void CTasPktMailboxMuxSession::config(uint32_t timeout_receive_ms, uint32_t max_num_bytes_rsp)
+{
+	assert(max_num_bytes_rsp % 4 == 0);
+	mTimeoutReceiveMs = timeout_receive_ms;
+	mMaxNumBytesRsp = max_num_bytes_rsp;
+}
+
+bool CTasPktMailboxMuxSession::connected()
+{
+	return mMux->connected();
+}
+
+bool CTasPktMailboxMuxSession::send(const uint32_t* rq, uint32_t num_pl2_pkt)
+{
+	if (!connected()) {
+		assert(false);
+		return false;
+	}
+
+	mRqBuf.clear();  // The capacity is kept for the next requests
+	uint32_t numPl2PktSend = 0;
+	uint32_t w = 0;
+	for (uint32_t p = 0; p < num_pl2_pkt; p++) {
+		assert(rq[w] % 4 == 0);
+		const uint32_t numWords = rq[w] / 4;
+		auto pl1 = (const tas_pl1rq_header_st*)&rq[w + 1];  // First PL1 packet of the PL2 packet
+		if (pl1->cmd == TAS_PL1_CMD_SERVER_CONNECT) {
+			// Sent once per connection by the mux. Clients send it first, so the response can be queued right away.
+			std::lock_guard<std::mutex> lock(mMux->mMutex);
+			assert(mRspQueue.empty());
+			mRspQueue.emplace_back(mMux->mServerConnectRsp.begin(), mMux->mServerConnectRsp.end());
+		}
+		else {
+			mRqBuf.insert(mRqBuf.end(), &rq[w], &rq[w + numWords]);
+			numPl2PktSend++;
+		}
+		w += numWords;
+	}
+
+	if (numPl2PktSend == 0)
+		return true;
+
+	return mMux->mSend(this, mRqBuf.data(), numPl2PktSend);
+}
+
+bool CTasPktMailboxMuxSession::receive(uint32_t* rsp, uint32_t* num_bytes_rsp)
+{
+	*num_bytes_rsp = mReceivePl2Pkt(rsp, mMaxNumBytesRsp);
+	return (*num_bytes_rsp != 0);
+}
+
+bool CTasPktMailboxMuxSession::execute(const uint32_t* rq, uint32_t* rsp, uint32_t num_pl2_pkt, uint32_t* num_bytes_rsp)
+{
+	if (num_bytes_rsp)
+		*num_bytes_rsp = 0;
+
+	if (!send(rq, num_pl2_pkt))
+		return false;
+
+	uint32_t numBytes = 0;
+	for (uint32_t p = 0; p < num_pl2_pkt; p++) {
+		uint32_t numBytesPkt = mReceivePl2Pkt(&rsp[numBytes / 4], mMaxNumBytesRsp - numBytes);
+		if (numBytesPkt == 0)
+			return false;
+		numBytes += numBytesPkt;
+	}
+
+	if (num_bytes_rsp)
+		*num_bytes_rsp = numBytes;
+
+	return true;
+}
+
+uint32_t CTasPktMailboxMuxSession::mReceivePl2Pkt(uint32_t* rsp, uint32_t max_num_bytes)
+{
+	using namespace std::chrono;
+	const steady_clock::time_point deadline = steady_clock::now() + milliseconds(mTimeoutReceiveMs);
+
+	std::unique_lock<std::mutex> lock(mMux->mMutex);
+	while (mRspQueue.empty()) {
+		if (!mMux->mReaderActive) {
+			if (!mMux->mConnected)
+				return 0;
+
+			// Read one packet without holding the lock, it can also belong to another session
+			uint32_t timeoutMs = mTimeoutReceiveMs;
+			if (mTimeoutReceiveMs != (uint32_t)-1) {  // Otherwise no timeout
+				auto remaining = duration_cast<milliseconds>(deadline - steady_clock::now()).count();
+				timeoutMs = (uint32_t)std::max<decltype(remaining)>(remaining, 0);
+			}
+			mMux->mReaderActive = true;
+			lock.unlock();
+			uint32_t numBytes;
+			bool ok = mMux->mSocketReceive(timeoutMs, &numBytes);
+			bool broken = !ok || !mMux->mConnected;  // Also broken by a sender while reading
+			std::unique_lock<std::mutex> sendLock(mMux->mSendMutex, std::defer_lock);
+			if (broken)
+				sendLock.lock();  // No sender may use the socket during the teardown
+			lock.lock();
+			mMux->mReaderActive = false;
+			if (broken)
+				mMux->mSocketDisconnect();
+			else if (numBytes != 0)
+				mMux->mRoute(numBytes);
+			mMux->mCv.notify_all();
+		}
+		else {
+			mMux->mCv.wait_until(lock, deadline);
+		}
+
+		if (mRspQueue.empty() && (steady_clock::now() >= deadline))
+			return 0;  // Timeout
+	}
+
+	const std::vector<uint32_t>& pkt = mRspQueue.front();
+	uint32_t numBytes = (uint32_t)pkt.size() * 4;
+	if (numBytes > max_num_bytes) {
+		assert(false);
+		numBytes = 0;
+	}
+	else {
+		memcpy(rsp, pkt.data(), numBytes);
+	}
+	mRspQueue.pop_front();
+	return numBytes;
+}
+
+CTasPktMailboxMux::CTasPktMailboxMux(const char* client_name)
+	: mTphsc(&mEi), mRspBuf(new uint32_t[TAS_PL2_MAX_PKT_SIZE / 4])
+{
+	tas_clear_error_info(&mEi);
+
+	assert(strlen(client_name) < TAS_NAME_LEN32);
+	snprintf(mClientName.data(), TAS_NAME_LEN32, "%s", client_name);
+	tasutil_get_user_name(mUserName.data());
+	mClientPid = tasutil_get_pid();
+}
+
+CTasPktMailboxMux::~CTasPktMailboxMux()
+{
+	assert(get_num_session() == 0);
+	delete mSocket;
+}
+
+tas_return_et CTasPktMailboxMux::server_connect(const char* ip_addr, uint16_t port_num, int timeout_ms)
+{
+	std::lock_guard<std::mutex> sendLock(mSendMutex);
+
+	if (mSocket != nullptr) {
+		assert(false);
+		snprintf(mEi.info, TAS_INFO_STR_LEN, "ERROR: Already connected to server");
+		mEi.tas_err = TAS_ERR_FN_USAGE;
+		return mEi.tas_err;
+	}
+
+	mServerInfo = nullptr;
+	mConIdRouting = false;
+
+	mSocket = new CTasTcpSocket();
+	if (!mSocket->connect(ip_addr, port_num, timeout_ms))
+		return mHandleErrorServerConnect(ip_addr, port_num);
+
+	// No session can read yet, since the connection is not flagged as connected
+	const uint32_t* pktRq = mTphsc.get_pkt_rq_server_connect(mClientName.data(), mUserName.data(), mClientPid);
+	uint32_t numBytes = 0;
+	if ((mSocket->sendAll(pktRq, (int)pktRq[0]) != 0)
+		|| !mSocketReceive(TAS_DEFAULT_TIMEOUT_MS, &numBytes) || (numBytes != sizeof(mServerConnectRsp)))
+		return mHandleErrorServerConnect(ip_addr, port_num);
+	memcpy(mServerConnectRsp.data(), mRspBuf.get(), numBytes);
+
+	const tas_server_info_st* serverInfo;
+	uint64_t challenge;
+	tas_return_et ret = mTphsc.set_pkt_rsp_server_connect(mServerConnectRsp.data(), &serverInfo, &challenge);
+	if ((ret != TAS_ERR_NONE) && (ret != TAS_ERR_SERVER_LOCKED)) {  // A locked server is unlocked by a session
+		delete mSocket;
+		mSocket = nullptr;
+		return ret;
+	}
+
+	mServerInfo = serverInfo;
+	mConIdRouting = (serverInfo->supp_feat >> TAS_SERVER_FEAT_CON_ID_SESSION) & 1;
+	mConnected = true;
+	return ret;
+}
+
+std::unique_ptr<CTasPktMailboxMuxSession> CTasPktMailboxMux::open_session()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	if (!mConnected) {
+		snprintf(mEi.info, TAS_INFO_STR_LEN, "ERROR: Not connected to a server");
+		mEi.tas_err = TAS_ERR_FN_USAGE;
+		return nullptr;
+	}
+
+	if (!mConIdRouting && std::any_of(mSession.begin(), mSession.end(), [](const CTasPktMailboxMuxSession* s) { return s != nullptr; })) {
+		snprintf(mEi.info, TAS_INFO_STR_LEN, "ERROR: Server %s supports only one session per connection", mServerInfo->server_name);
+		mEi.tas_err = TAS_ERR_FN_NOT_SUPPORTED;
+		return nullptr;
+	}
+
+	// A con_id with outstanding responses of a closed session is not reused
+	uint32_t conId = 0;
+	while ((conId < CON_ID_NONE) && ((mSession[conId] != nullptr) || (mNumRspConId[conId] != 0)))
+		conId++;
+	if (conId == CON_ID_NONE) {
+		snprintf(mEi.info, TAS_INFO_STR_LEN, "ERROR: All connection identifiers are in use");
+		mEi.tas_err = TAS_ERR_FN_USAGE;
+		return nullptr;
+	}
+
+	std::unique_ptr<CTasPktMailboxMuxSession> session(new CTasPktMailboxMuxSession(this, (uint8_t)conId));
+	mSession[conId] = session.get();
+	return session;
+}
+
+uint32_t CTasPktMailboxMux::get_num_session() const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return (uint32_t)std::count_if(mSession.begin(), mSession.end(), [](const CTasPktMailboxMuxSession* s) { return s != nullptr; });
+}
+
+CTasPktMailboxMux::tas_mux_route_et CTasPktMailboxMux::mGetRoute(uint8_t cmd) const
+{
+	switch (cmd) {
+	case TAS_PL1_CMD_SESSION_START:
+	case TAS_PL1_CMD_PING:
+	case TAS_PL1_CMD_DEVICE_CONNECT:
+	case TAS_PL1_CMD_DEVICE_RESET_COUNT:
+	case TAS_PL1_CMD_GET_CHALLENGE:
+	case TAS_PL1_CMD_SET_DEVICE_KEY:
+	case TAS_PL1_CMD_PL0_START:
+		return (mConIdRouting) ? MUX_ROUTE_CON_ID : MUX_ROUTE_ORDER;
+	case TAS_PL1_CMD_CHL_SUBSCRIBE:
+	case TAS_PL1_CMD_CHL_UNSUBSCRIBE:
+	case TAS_PL1_CMD_CHL_MSG_C2D:
+	case TAS_PL1_CMD_CHL_MSG_D2C:
+		return MUX_ROUTE_CHL;
+	case TAS_PL1_CMD_TRC_SUBSCRIBE:
+	case TAS_PL1_CMD_TRC_UNSUBSCRIBE:
+	case TAS_PL1_CMD_TRC_DATA:
+		return MUX_ROUTE_TRC;
+	default:
+		return MUX_ROUTE_ORDER;
+	}
+}
+
+bool CTasPktMailboxMux::mSend(CTasPktMailboxMuxSession* session, uint32_t* rq, uint32_t num_pl2_pkt)
+{
+	std::lock_guard<std::mutex> sendLock(mSendMutex);
+
+	if (!mConnected)
+		return false;
+
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mRegisterRq(session, rq, num_pl2_pkt);
+	}
+
+	uint32_t w = 0;
+	for (uint32_t p = 0; p < num_pl2_pkt; p++) {
+		uint32_t pktSize = rq[w];
+		assert(pktSize <= TAS_PL2_MAX_PKT_SIZE);
+		if (mSocket->sendAll(&rq[w], (int)pktSize) != 0) {
+			mConnected = false;
+			std::lock_guard<std::mutex> lock(mMutex);
+			if (!mReaderActive)
+				mSocketDisconnect();  // Otherwise torn down by the reading session
+			return false;
+		}
+		w += pktSize / 4;
+	}
+	return true;
+}
+
+void CTasPktMailboxMux::mRegisterRq(CTasPktMailboxMuxSession* session, uint32_t* rq, uint32_t num_pl2_pkt)
+{
+	uint32_t w = 0;
+	for (uint32_t p = 0; p < num_pl2_pkt; p++) {
+		auto pl1 = (tas_pl1rq_header_st*)&rq[w + 1];  // First PL1 packet of the PL2 packet
+		switch (mGetRoute(pl1->cmd)) {
+		case MUX_ROUTE_CON_ID:
+			pl1->con_id = session->mConId;
+			mNumRspConId[session->mConId]++;
+			break;
+		case MUX_ROUTE_CHL:    mChlConId = session->mConId;     break;
+		case MUX_ROUTE_TRC:    mTrcConId = session->mConId;     break;
+		case MUX_ROUTE_ORDER:  mOrderConId.push_back(session->mConId); break;
+		}
+		w += rq[w] / 4;
+	}
+}
+
+void CTasPktMailboxMux::mRoute(uint32_t num_bytes)
+{
+	auto pl1 = (const tas_pl1rsp_header_st*)&mRspBuf[1];
+
+	uint8_t conId = CON_ID_NONE;
+	switch (mGetRoute(pl1->cmd)) {
+	case MUX_ROUTE_CON_ID:
+		conId = pl1->con_id;
+		if ((conId == CON_ID_NONE) || (mNumRspConId[conId] == 0)) {
+			assert(false);  // Not requested
+			return;
+		}
+		mNumRspConId[conId]--;
+		break;
+	case MUX_ROUTE_CHL:    conId = mChlConId;   break;
+	case MUX_ROUTE_TRC:    conId = mTrcConId;   break;
+	case MUX_ROUTE_ORDER:
+		if (!mOrderConId.empty()) {
+			conId = mOrderConId.front();
+			mOrderConId.pop_front();
+		}
+		break;
+	}
+
+	if ((conId == CON_ID_NONE) || (mSession[conId] == nullptr))
+		return;  // Late response of a closed session
+
+	mSession[conId]->mRspQueue.emplace_back(&mRspBuf[0], &mRspBuf[num_bytes / 4]);
+}
+
+bool CTasPktMailboxMux::mSocketReceive(uint32_t timeout_ms, uint32_t* num_bytes)
+{
+	*num_bytes = 0;
+
+	int ret = mSocket->select_socket(std::max(timeout_ms, 1u));
+	if (ret == 0)
+		return true;  // Timeout is no error
+	if (ret < 0)
+		return false;
+
+	// The rest of the packet follows without a gap, no timeout is needed
+	auto recvAll = [this](void* buf, uint32_t len) {
+		for (uint32_t n = 0; n < len; ) {
+			int numRecv = mSocket->recv((char*)buf + n, (int)(len - n));
+			if (numRecv <= 0)
+				return false;
+			n += (uint32_t)numRecv;
+		}
+		return true;
+	};
+
+	if (!recvAll(&mRspBuf[0], 4))
+		return false;
+
+	uint32_t pktSize = mRspBuf[0];
+	if ((pktSize % 4 != 0) || (pktSize < 8) || (pktSize > TAS_PL2_MAX_PKT_SIZE)) {
+		assert(false);  // Out of sync
+		return false;
+	}
+	if (!recvAll(&mRspBuf[1], pktSize - 4))
+		return false;
+
+	*num_bytes = pktSize;
+	return true;
+}
+
+void CTasPktMailboxMux::mSocketDisconnect()
+{
+	assert(!mReaderActive);
+	mConnected = false;
+	delete mSocket;
+	mSocket = nullptr;
+
+	// Outstanding responses will not arrive anymore
+	mNumRspConId.fill(0);
+	mOrderConId.clear();
+	mChlConId = CON_ID_NONE;
+	mTrcConId = CON_ID_NONE;
+}
+
+tas_return_et CTasPktMailboxMux::mHandleErrorServerConnect(const char* ip_addr, uint16_t port_num)
+{
+	delete mSocket;
+	mSocket = nullptr;
+
+	snprintf(mEi.info, TAS_INFO_STR_LEN, "ERROR: Server %s port %d", ip_addr, port_num);
+	mEi.tas_err = TAS_ERR_SERVER_CON;
+	return mEi.tas_err;
+}
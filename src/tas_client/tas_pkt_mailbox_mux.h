@@ -0,0 +1,245 @@
+/*
+ *  Copyright (c) 2024 Infineon Technologies AG.
+ *
+ *  This file is part of TAS Client, an API for device access for Infineon's 
+ *  automotive MCUs. 
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *  **************************************************************************************************************** */
+
+#pragma once
+
+//! \addtogroup Client_API
+//! \{
+
+// TAS includes
+#include "tas_pkt_mailbox_if.h"
+#include "tas_pkt_handler_server_con.h"
+#include "tas_client_impl.h"
+
+// TAS Socket includes
+#include "tas_tcp_socket.h"
+
+// Standard includes
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class CTasPktMailboxMux;
+
+//! \brief Mailbox of a logical session which is multiplexed over the connection of a \ref CTasPktMailboxMux
+//! \details Created by \ref CTasPktMailboxMux::open_session() and passed to the constructor of a client. The session
+//! object must outlive the client. Sessions can be used by different threads.
+class CTasPktMailboxMuxSession final : public CTasPktMailboxIf
+{
+
+public:
+	CTasPktMailboxMuxSession(const CTasPktMailboxMuxSession&) = delete; //!< \brief delete the copy constructor
+	CTasPktMailboxMuxSession operator= (const CTasPktMailboxMuxSession&) = delete; //!< \brief delete copy-assignment operator
+
+	//! \brief Session destructor. Releases the connection identifier.
+	//! \details Responses which are still outstanding are dropped when they arrive. The connection identifier is
+	//! not reused before.
+	~CTasPktMailboxMuxSession();
+
+	//! \brief Get the connection identifier which tags the packets of this session.
+	//! \returns the connection identifier
+	uint8_t get_con_id() const { return mConId; }
+
+	// CTasPktMailboxIf
+	void config(uint32_t timeout_receive_ms, uint32_t max_num_bytes_rsp);
+	bool connected();
+	bool send(const uint32_t* rq, uint32_t num_pl2_pkt = 1);
+	bool receive(uint32_t* rsp, uint32_t* num_bytes_rsp);
+	bool execute(const uint32_t* rq, uint32_t* rsp, uint32_t num_pl2_pkt = 1, uint32_t* num_bytes_rsp = nullptr);
+
+private:
+
+	friend class CTasPktMailboxMux;
+
+	//! \brief Session constructor. Only called by \ref CTasPktMailboxMux::open_session().
+	//! \param mux multiplexed connection
+	//! \param con_id connection identifier of the session
+	CTasPktMailboxMuxSession(CTasPktMailboxMux* mux, uint8_t con_id);
+
+	//! \brief Receive the next PL2 packet of this session.
+	//! \details Whichever session waits first reads from the socket and hands packets of other sessions over to
+	//! their queues. The other sessions wait for their queues in the meantime.
+	//! \param rsp pointer to a response packet buffer
+	//! \param max_num_bytes maximum number of bytes in rsp
+	//! \returns the number of received bytes, 0 in case of a timeout or an error
+	uint32_t mReceivePl2Pkt(uint32_t* rsp, uint32_t max_num_bytes);
+
+	CTasPktMailboxMux* mMux;	//!< \brief Multiplexed connection
+	uint8_t mConId;				//!< \brief Connection identifier of the session
+
+	uint32_t mTimeoutReceiveMs = 0;	//!< \brief Timeout value in milliseconds for the receive operation
+	uint32_t mMaxNumBytesRsp = 0;	//!< \brief Defines the maximum number of bytes in a response packet
+
+	std::vector<uint32_t> mRqBuf;	//!< \brief Copy of the request packets which are sent to the server
+
+	std::deque<std::vector<uint32_t>> mRspQueue;	//!< \brief Received PL2 packets, protected by the mutex of mMux
+};
+
+//! \brief One TAS server connection which carries several sessions
+//! \details The connection is set up by \ref server_connect() with one server connect request. The server connect
+//! requests of the clients are answered locally with the response of this request. \n
+//! Several sessions need a server which advertises \ref TAS_SERVER_FEAT_CON_ID_SESSION. Each session gets a
+//! connection identifier. It is set in the con_id field of the PL1 requests which have one (session start, ping,
+//! device connect and unlock, PL0 start) and responses with such a command are routed by their con_id.
+//! Other responses are routed by command: channel packets to the session which sent the last channel request,
+//! trace packets to the session which sent the last trace request, and server level responses (get targets/clients,
+//! errors) in request order. Therefore only one channel and one trace session per connection are supported. \n
+//! Servers without this feature keep one session per connection. Then only one session can be opened and the
+//! connection is used like the one of a single client. Use one connection per client in this case.
+class CTasPktMailboxMux
+{
+
+public:
+	CTasPktMailboxMux(const CTasPktMailboxMux&) = delete; //!< \brief delete the copy constructor
+	CTasPktMailboxMux operator= (const CTasPktMailboxMux&) = delete; //!< \brief delete copy-assignment operator
+
+	//! \brief Multiplexed mailbox constructor.
+	//! \param client_name name of the connection as shown by the server
+	explicit CTasPktMailboxMux(const char* client_name);
+
+	//! \brief Multiplexed mailbox destructor. All sessions have to be destroyed before.
+	~CTasPktMailboxMux();
+
+	//! \brief Connect to a TAS server and send the server connect request of the connection.
+	//! \param ip_addr server's IP address or a hostname
+	//! \param port_num server's port number
+	//! \param timeout_ms connect timeout in milliseconds, default: -1 blocks until the connection is established
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et server_connect(const char* ip_addr, uint16_t port_num = TAS_PORT_NUM_SERVER_DEFAULT, int timeout_ms = -1);
+
+	//! \brief Get the server information.
+	//! \returns pointer to the server information from the last successful \ref server_connect() call, \c nullptr if none
+	const tas_server_info_st* get_server_info() const { return mServerInfo; }
+
+	//! \brief Check if the sessions are routed by their connection identifier.
+	//! \returns \c true if the server supports \ref TAS_SERVER_FEAT_CON_ID_SESSION, otherwise \c false
+	bool get_con_id_routing() const { return mConIdRouting; }
+
+	//! \brief Get the error information of the last failed \ref server_connect() or \ref open_session() call.
+	//! \returns pointer to a c-string with the error information
+	const char* get_error_info() { return tas_get_error_info(&mEi); }
+
+	//! \brief Check if connected.
+	//! \returns \c true if yes, otherwise \c false
+	bool connected() const { return mConnected; }
+
+	//! \brief Open a new session on this connection.
+	//! \details Has to be called after \ref server_connect(). Without \ref get_con_id_routing() only one session
+	//! can be open at a time.
+	//! \returns pointer to the session mailbox, \c nullptr if no further session can be opened, see \ref get_error_info()
+	std::unique_ptr<CTasPktMailboxMuxSession> open_session();
+
+	//! \brief Get the number of open sessions.
+	//! \returns the number of open sessions
+	uint32_t get_num_session() const;
+
+	//! \brief Connection identifier limits.
+	enum {
+		CON_ID_NONE = 0xFF,		//!< \brief Value of con_id in packets which are not multiplexed
+	};
+
+private:
+
+	friend class CTasPktMailboxMuxSession;
+
+	//! \brief Routing class of a PL1 command
+	enum tas_mux_route_et {
+		MUX_ROUTE_CON_ID,	//!< \brief Routed by the con_id field
+		MUX_ROUTE_CHL,		//!< \brief Routed to the session which sent the last channel request
+		MUX_ROUTE_TRC,		//!< \brief Routed to the session which sent the last trace request
+		MUX_ROUTE_ORDER,	//!< \brief Routed in request order
+	};
+
+	//! \brief Get the routing class of a PL1 command.
+	//! \param cmd PL1 command
+	//! \returns routing class
+	tas_mux_route_et mGetRoute(uint8_t cmd) const;
+
+	//! \brief Send the requests of a session.
+	//! \param session sending session
+	//! \param rq pointer to a copy of the request packets
+	//! \param num_pl2_pkt number of PL2 packets within the buffer
+	//! \returns \c true on success, otherwise \c false
+	bool mSend(CTasPktMailboxMuxSession* session, uint32_t* rq, uint32_t num_pl2_pkt);
+
+	//! \brief Register the requests of a session before they are sent. Sets the con_id of the requests.
+	//! mMutex is locked.
+	//! \param session sending session
+	//! \param rq pointer to a copy of the request packets
+	//! \param num_pl2_pkt number of PL2 packets within the buffer
+	void mRegisterRq(CTasPktMailboxMuxSession* session, uint32_t* rq, uint32_t num_pl2_pkt);
+
+	//! \brief Hand a received PL2 packet in mRspBuf over to the queue of its session. mMutex is locked.
+	//! \param num_bytes number of bytes in the packet
+	void mRoute(uint32_t num_bytes);
+
+	//! \brief Receive one PL2 packet from the socket into mRspBuf.
+	//! \param timeout_ms timeout in milliseconds until the packet starts
+	//! \param num_bytes number of received bytes, 0 in case of a timeout
+	//! \returns \c true on success or timeout, \c false in case of a connection error
+	bool mSocketReceive(uint32_t timeout_ms, uint32_t* num_bytes);
+
+	//! \brief Close the connection. Used in case of a fatal error.
+	//! \details mSendMutex and mMutex are locked and no session reads from the socket.
+	void mSocketDisconnect();
+
+	//! \brief Set the error info of a failed server connection.
+	//! \param ip_addr server's IP address or a hostname
+	//! \param port_num server's port number
+	//! \returns \ref TAS_ERR_SERVER_CON
+	tas_return_et mHandleErrorServerConnect(const char* ip_addr, uint16_t port_num);
+
+	tas_error_info_st mEi;				//!< \brief TAS error info of the connection setup
+	CTasPktHandlerServerCon mTphsc;		//!< \brief Packet handler for the server connect request
+
+	std::array<char, TAS_NAME_LEN32> mClientName;	//!< \brief Client name as in \ref tas_pl1rq_server_connect_st
+	std::array<char, TAS_NAME_LEN16> mUserName;		//!< \brief User name as in \ref tas_pl1rq_server_connect_st
+	uint32_t mClientPid;							//!< \brief Process id as in \ref tas_pl1rq_server_connect_st
+
+	//! \brief Server connect response which answers the server connect requests of the sessions
+	std::array<uint32_t, (4 + sizeof(tas_pl1rsp_server_connect_st)) / 4> mServerConnectRsp = {};
+	const tas_server_info_st* mServerInfo = nullptr;	//!< \brief Server information, \c nullptr if no server connected
+	bool mConIdRouting = false;		//!< \brief Server supports \ref TAS_SERVER_FEAT_CON_ID_SESSION
+
+	//! \brief Socket which is connected to a TAS server
+	//! \details Used by senders with mSendMutex locked and by the reading session. Deleted with both mutexes
+	//! locked and no session reading.
+	CTasTcpSocket* mSocket = nullptr;
+	std::atomic<bool> mConnected = false;	//!< \brief Connection is set up and not broken
+
+	mutable std::mutex mMutex;		//!< \brief Protects the routing state and the session queues
+	std::condition_variable mCv;	//!< \brief Signals received packets and the end of a socket read
+	bool mReaderActive = false;		//!< \brief A session reads from the socket
+
+	std::mutex mSendMutex;			//!< \brief Keeps the PL2 packets of one request together. Locked before mMutex.
+
+	std::array<CTasPktMailboxMuxSession*, CON_ID_NONE> mSession = {};	//!< \brief Open sessions by con_id
+	std::array<uint32_t, CON_ID_NONE> mNumRspConId = {};	//!< \brief Outstanding responses routed by con_id
+	std::deque<uint8_t> mOrderConId;		//!< \brief Sessions which wait for responses routed in request order, CON_ID_NONE if closed
+	uint8_t mChlConId = CON_ID_NONE;		//!< \brief Session which sent the last channel request
+	uint8_t mTrcConId = CON_ID_NONE;		//!< \brief Session which sent the last trace request
+
+	std::unique_ptr<uint32_t[]> mRspBuf;	//!< \brief Receive buffer for one PL2 packet
+};
+
+//! \} // end of group Client_API
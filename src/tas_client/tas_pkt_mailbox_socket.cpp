@@ -24,12 +24,12 @@
 #include <cassert>
 #include <iostream>
 
-bool CTasPktMailboxSocket::server_connect(const char* ip_addr, uint16_t port_num)
+bool CTasPktMailboxSocket::server_connect(const char* ip_addr, uint16_t port_num, int timeout_ms)
 {
 	assert(!connected());
 
 	mSocket = new CTasTcpSocket();
-	if (!mSocket->connect(ip_addr, port_num))
+	if (!mSocket->connect(ip_addr, port_num, timeout_ms))
 	{
 		return false;
 	}
@@ -44,6 +44,18 @@ void CTasPktMailboxSocket::config(uint32_t timeout_receive_ms, uint32_t max_num_
 	mMaxNumBytesRsp = max_num_bytes_rsp;
 }
 
+bool CTasPktMailboxSocket::connected_idle()
+{
+	if (!connected())
+		return false;
+
+	if (!mSocket->check_idle()) {
+		mSocketDisconnect();  // Closed by the server or out of sync
+		return false;
+	}
+	return true;
+}
+
 bool CTasPktMailboxSocket::send(const uint32_t* rq, uint32_t num_pl2_pkt)
 {
 	if (!connected()) {
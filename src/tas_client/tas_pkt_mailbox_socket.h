@@ -48,12 +48,14 @@ public:
 	//! \brief Connect to a TAS server.
 	//! \param ip_addr server's IP address or a hostname
 	//! \param port_num server's port number
+	//! \param timeout_ms connect timeout in milliseconds, default: -1 blocks until the connection is established
 	//! \returns \c true on success, otherwise \c false
-	bool server_connect(const char* ip_addr, uint16_t port_num);
+	bool server_connect(const char* ip_addr, uint16_t port_num, int timeout_ms = -1);
 
 	// CTasPktMailboxIf
 	void config(uint32_t timeout_receive_ms, uint32_t max_num_bytes_rsp);
 	bool connected() { return (mSocket != nullptr); }
+	bool connected_idle();
 	bool send(const uint32_t* rq, uint32_t num_pl2_pkt = 1);
 	bool receive(uint32_t* rsp, uint32_t* num_bytes_rsp);
 	bool execute(const uint32_t* rq, uint32_t* rsp, uint32_t num_pl2_pkt = 1, uint32_t* num_bytes_rsp = nullptr);
@@ -0,0 +1,235 @@
+/*
+ *  Copyright (c) 2024 Infineon Technologies AG.
+ *
+ *  This file is part of TAS Client, an API for device access for Infineon's
+ *  automotive MCUs.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *  **************************************************************************************************************** */
+// TAS includes
+#include "tas_rw_span_planner.h"
+#include "tas_pkt.h"
+
+// Standard includes
+#include <cassert>
+#include <cstring>
+#include <algorithm>
+
+void CTasRwSpanPlanner::add_safe_region(uint64_t addr, uint64_t num_bytes, uint8_t addr_map)
+{
+	if (num_bytes == 0)
+		return;
+	mSafeRegion.push_back({ addr, addr + num_bytes, addr_map });
+}
+
+void CTasRwSpanPlanner::set_cost_model(uint32_t num_bytes_pl0_overhead, uint32_t max_span_size)
+{
+	mPl0Overhead = num_bytes_pl0_overhead;
+	mMaxSpanSize = max_span_size;
+}
+
+int32_t CTasRwSpanPlanner::mGetSafeRegion(const tas_rw_trans_st* trans) const
+{
+	if (trans->addr_map >= TAS_AM12)
+		return -1;  // Block transfers of these address maps are never split, spans could exceed a PL2 packet
+
+	for (uint32_t r = 0; r < mSafeRegion.size(); r++) {
+		const tas_safe_region_st& sr = mSafeRegion[r];
+		if ((trans->addr_map == sr.addr_map) && (trans->addr >= sr.addr) && (trans->addr + trans->num_bytes <= sr.addr_end))
+			return (int32_t)r;
+	}
+	return -1;
+}
+
+uint64_t CTasRwSpanPlanner::mGetCost(uint64_t addr, uint64_t num_bytes) const
+{
+	// Same split into PL0 transactions as CTasPktHandlerRw::rw_add_rd(). Reads of up to 4 bytes return a full word.
+	uint64_t a = addr;
+	uint64_t nb = num_bytes;
+	uint64_t numPl0 = 0;
+	uint64_t numBytesRsp = 0;
+
+	if ((nb > 0) && (a & 1)) {
+		numPl0++; numBytesRsp += 4; a++; nb--;
+	}
+	if ((nb >= 2) && (a & 2)) {
+		numPl0++; numBytesRsp += 4; a += 2; nb -= 2;
+	}
+	if ((nb >= 4) && (a & 4)) {
+		numPl0++; numBytesRsp += 4; a += 4; nb -= 4;
+	}
+	if (nb >= 8) {
+		uint64_t nbBlk = nb & ~7ull;
+		numPl0 += (nbBlk + TAS_PL0_DATA_BLK_SIZE - 1) / TAS_PL0_DATA_BLK_SIZE;
+		numBytesRsp += nbBlk; a += nbBlk; nb -= nbBlk;
+	}
+	if (nb >= 4) {
+		numPl0++; numBytesRsp += 4; nb -= 4;
+	}
+	if (nb >= 2) {
+		numPl0++; numBytesRsp += 4; nb -= 2;
+	}
+	if (nb > 0) {
+		numPl0++; numBytesRsp += 4; nb--;
+	}
+	assert(nb == 0);
+
+	return numBytesRsp + numPl0 * mPl0Overhead;
+}
+
+const tas_rw_trans_st* CTasRwSpanPlanner::plan(const tas_rw_trans_st* trans, uint32_t num_trans, uint32_t* num_trans_planned)
+{
+	mTransPlanned.clear();
+	mSpan.clear();
+	mSpanCopy.clear();
+	mNumRdMerged = 0;
+	mNumBytesGap = 0;
+	mSpanDataSize = 0;
+
+	// Writes, fills and reads outside of the safe regions are barriers, which keep their position in the list
+	mRunRegion.resize(num_trans);
+	for (uint32_t t = 0; t < num_trans; t++)
+		mRunRegion[t] = ((trans[t].type == TAS_RW_TT_RD) && (trans[t].num_bytes > 0)) ? mGetSafeRegion(&trans[t]) : -1;
+
+	uint32_t t = 0;
+	while (t < num_trans) {
+		if (mRunRegion[t] < 0) {
+			mTransPlanned.push_back(trans[t]);  // Passed unchanged
+			t++;
+			continue;
+		}
+		uint32_t tRunStart = t;
+		while ((t < num_trans) && (mRunRegion[t] >= 0))
+			t++;
+		mPlanRdRun(&trans[tRunStart], &mRunRegion[tRunStart], t - tRunStart);
+	}
+
+	// The span data buffer is only allocated now, so that its address is stable
+	mSpanData.resize(mSpanDataSize / 8);
+	for (const tas_span_st& span : mSpan)
+		mTransPlanned[span.trans_idx].rdata = (uint8_t*)mSpanData.data() + span.data_offset;
+
+	*num_trans_planned = (uint32_t)mTransPlanned.size();
+	return mTransPlanned.data();
+}
+
+void CTasRwSpanPlanner::mPlanRdRun(const tas_rw_trans_st* trans, const int32_t* run_region, uint32_t num_trans)
+{
+	assert(num_trans > 0);
+	mRunOrder.resize(num_trans);
+	for (uint32_t t = 0; t < num_trans; t++) {
+		assert(run_region[t] >= 0);
+		mRunOrder[t] = t;
+	}
+
+	// Reads of the same region and access mode with ascending addresses are neighbors
+	std::sort(mRunOrder.begin(), mRunOrder.end(), [&](uint32_t i, uint32_t j) {
+		if (run_region[i] != run_region[j])
+			return run_region[i] < run_region[j];
+		if (trans[i].acc_mode != trans[j].acc_mode)
+			return trans[i].acc_mode < trans[j].acc_mode;
+		return trans[i].addr < trans[j].addr;
+	});
+
+	uint32_t kStart = 0;
+	int32_t region = run_region[mRunOrder[0]];
+	uint64_t addr = trans[mRunOrder[0]].addr;
+	uint64_t addrEnd = addr + trans[mRunOrder[0]].num_bytes;
+	uint64_t cost = mGetCost(addr, addrEnd - addr);
+	for (uint32_t k = 1; k < mRunOrder.size(); k++) {
+		const tas_rw_trans_st& tr = trans[mRunOrder[k]];
+		uint64_t trEnd = tr.addr + tr.num_bytes;
+		uint64_t addrEndMerged = std::max(addrEnd, trEnd);
+		bool merge = (run_region[mRunOrder[k]] == region) && (tr.acc_mode == trans[mRunOrder[kStart]].acc_mode)
+			&& (addrEndMerged - addr <= mMaxSpanSize);
+		uint64_t costMerged = 0;
+		if (merge) {
+			uint64_t addrSpan = addr, addrEndSpan = addrEndMerged;
+			mAlignSpan(&addrSpan, &addrEndSpan, region);
+			costMerged = mGetCost(addrSpan, addrEndSpan - addrSpan);
+			merge = (tr.addr <= addrEnd) || (costMerged <= cost + mGetCost(tr.addr, tr.num_bytes));
+		}
+		if (merge) {
+			addrEnd = addrEndMerged;
+			cost = costMerged;
+		}
+		else {
+			mAddCluster(trans, &mRunOrder[kStart], k - kStart, addr, addrEnd, region);
+			kStart = k;
+			region = run_region[mRunOrder[k]];
+			addr = tr.addr;
+			addrEnd = trEnd;
+			cost = mGetCost(addr, addrEnd - addr);
+		}
+	}
+	mAddCluster(trans, &mRunOrder[kStart], (uint32_t)mRunOrder.size() - kStart, addr, addrEnd, region);
+}
+
+void CTasRwSpanPlanner::mAlignSpan(uint64_t* addr, uint64_t* addr_end, int32_t region) const
+{
+	// Widening to 64 bit alignment saves the PL0 transactions of unaligned heads and tails
+	const tas_safe_region_st& sr = mSafeRegion[region];
+	uint64_t addrAligned = *addr & ~7ull;
+	uint64_t addrEndAligned = (*addr_end + 7) & ~7ull;
+	if ((addrAligned >= sr.addr) && (addrEndAligned <= sr.addr_end) && (addrEndAligned - addrAligned <= mMaxSpanSize)
+		&& (mGetCost(addrAligned, addrEndAligned - addrAligned) < mGetCost(*addr, *addr_end - *addr))) {
+		*addr = addrAligned;
+		*addr_end = addrEndAligned;
+	}
+}
+
+void CTasRwSpanPlanner::mAddCluster(const tas_rw_trans_st* trans, const uint32_t* order, uint32_t num, uint64_t addr, uint64_t addr_end, int32_t region)
+{
+	assert(num > 0);
+	if (num == 1) {
+		mTransPlanned.push_back(trans[order[0]]);
+		return;
+	}
+
+	mAlignSpan(&addr, &addr_end, region);
+
+	const tas_rw_trans_st& trFirst = trans[order[0]];
+	auto spanNumBytes = (uint32_t)(addr_end - addr);
+	mSpan.push_back({ (uint32_t)mTransPlanned.size(), mSpanDataSize });
+	mTransPlanned.push_back({ addr, spanNumBytes, trFirst.acc_mode, trFirst.addr_map, TAS_RW_TT_RD, nullptr });  // rdata set in plan()
+
+	uint64_t addrCovered = addr;  // Reads are sorted by address
+	uint64_t numBytesCovered = 0;
+	for (uint32_t k = 0; k < num; k++) {
+		const tas_rw_trans_st& tr = trans[order[k]];
+		mSpanCopy.push_back({ tr.rdata, (uint32_t)mSpan.size() - 1, (uint32_t)(tr.addr - addr), tr.num_bytes });
+		uint64_t trEnd = tr.addr + tr.num_bytes;
+		if (trEnd > addrCovered) {
+			numBytesCovered += trEnd - std::max(addrCovered, tr.addr);
+			addrCovered = trEnd;
+		}
+	}
+
+	mNumRdMerged += num;
+	mNumBytesGap += spanNumBytes - (uint32_t)numBytesCovered;
+	mSpanDataSize += (spanNumBytes + 7) & ~7u;
+}
+
+void CTasRwSpanPlanner::complete()
+{
+	auto spanData = (const uint8_t*)mSpanData.data();
+	for (const tas_span_copy_st& sc : mSpanCopy)
+		memcpy(sc.rdata, spanData + mSpan[sc.span].data_offset + sc.offset, sc.num_bytes);
+}
+
+void CTasRwSpanPlanner::get_plan_stats(uint32_t* num_rd_merged, uint32_t* num_span, uint32_t* num_bytes_gap) const
+{
+	*num_rd_merged = mNumRdMerged;
+	*num_span = (uint32_t)mSpan.size();
+	*num_bytes_gap = mNumBytesGap;
+}
@@ -0,0 +1,164 @@
+/*
+ *  Copyright (c) 2024 Infineon Technologies AG.
+ *
+ *  This file is part of TAS Client, an API for device access for Infineon's
+ *  automotive MCUs.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *  **************************************************************************************************************** */
+
+#pragma once
+
+//! \addtogroup Packet_Handler_RW
+//! \{
+
+// TAS includes
+#include "tas_client.h"
+#include "tas_am15_am14.h"
+
+// Standard includes
+#include <vector>
+
+//! \brief Planner which merges scattered reads into span reads
+//! \details Optional stage in front of CTasPktHandlerRw or CTasClientRwBase::execute_trans(). Reads which are
+//! clustered with small gaps in a region marked as safe to over-read are replaced by one read over the whole span.
+//! The gap bytes are read and discarded. A cost model decides whether the per PL0 transaction overhead of separate
+//! reads is higher than the additional response bytes of the span. \n
+//! Only consecutive reads in safe regions are merged and reordered. Writes, fills and reads outside of the safe
+//! regions are passed unchanged and keep their position relative to all other transactions. Do not mark peripheral
+//! registers with read side effects as safe. \n
+//! Usage: \ref plan, execute the planned transactions, then \ref complete to copy the read data to the callers' buffers.
+class CTasRwSpanPlanner
+{
+
+public:
+	CTasRwSpanPlanner(const CTasRwSpanPlanner&) = delete; //!< \brief delete the copy constructor
+	CTasRwSpanPlanner operator= (const CTasRwSpanPlanner&) = delete; //!< \brief delete copy-assignment operator
+
+	//! \brief Span read planner object constructor.
+	CTasRwSpanPlanner() {}
+
+	//! \brief Mark a region as safe to over-read
+	//! \param addr start address of the region
+	//! \param num_bytes size of the region in bytes
+	//! \param addr_map address map of the region, default: \ref TAS_AM0. Regions with address maps >= TAS_AM12 are ignored.
+	void add_safe_region(uint64_t addr, uint64_t num_bytes, uint8_t addr_map = TAS_AM0);
+
+	//! \brief Remove all safe regions. Subsequent plans pass all reads unchanged.
+	void clear_safe_regions() { mSafeRegion.clear(); }
+
+	//! \brief Set the cost model
+	//! \details The cost of a read is the number of response data bytes plus num_bytes_pl0_overhead for each
+	//! PL0 transaction it needs. Reads are merged if the span costs less than the separate reads.
+	//! \param num_bytes_pl0_overhead cost of a PL0 transaction in bytes, default: \ref PL0_OVERHEAD_DEFAULT
+	//! \param max_span_size maximum size of a span read in bytes, default: \ref MAX_SPAN_SIZE_DEFAULT
+	void set_cost_model(uint32_t num_bytes_pl0_overhead, uint32_t max_span_size);
+
+	//! \brief Plan a list of transactions
+	//! \details The planned list is valid until the next call of plan. Read transactions of the planned list do
+	//! not correspond to the transactions of the input list, e.g. for CTasPktHandlerRw::rw_get_trans_rsp().
+	//! \param trans pointer to a list of transactions
+	//! \param num_trans number of transactions in the list
+	//! \param num_trans_planned pointer to the number of transactions in the planned list
+	//! \returns pointer to the planned list of transactions
+	const tas_rw_trans_st* plan(const tas_rw_trans_st* trans, uint32_t num_trans, uint32_t* num_trans_planned);
+
+	//! \brief Copy the read data of the spans to the read buffers of the transactions passed to \ref plan
+	//! \details Only call after a successful execution of the planned list.
+	void complete();
+
+	//! \brief Get the figures of the last plan
+	//! \param num_rd_merged pointer to the number of reads which were merged into span reads
+	//! \param num_span pointer to the number of span reads
+	//! \param num_bytes_gap pointer to the number of bytes which are read in addition and discarded
+	void get_plan_stats(uint32_t* num_rd_merged, uint32_t* num_span, uint32_t* num_bytes_gap) const;
+
+	//! \brief Default settings of the cost model.
+	enum {
+		PL0_OVERHEAD_DEFAULT = 12,		//!< \brief PL0 read command and response header plus an average share of base address changes
+		MAX_SPAN_SIZE_DEFAULT = 4096,	//!< \brief Maximum size of a span read
+	};
+
+private:
+
+	//! \brief Region which may be read without side effects
+	typedef struct {
+		uint64_t addr;		//!< \brief Start address
+		uint64_t addr_end;	//!< \brief First address after the region
+		uint8_t  addr_map;	//!< \brief Address map
+	} tas_safe_region_st;
+
+	//! \brief Span read of the planned list
+	typedef struct {
+		uint32_t trans_idx;		//!< \brief Index of the span read in mTransPlanned
+		uint32_t data_offset;	//!< \brief Offset of the span data in mSpanData in bytes
+	} tas_span_st;
+
+	//! \brief Read which is served from the data of a span read
+	typedef struct {
+		void*    rdata;		//!< \brief Read buffer of the caller
+		uint32_t span;		//!< \brief Index of the span read in mSpan
+		uint32_t offset;	//!< \brief Offset of the read data in the span
+		uint32_t num_bytes;	//!< \brief Number of bytes
+	} tas_span_copy_st;
+
+	//! \brief Get the safe region which contains a read.
+	//! \param trans pointer to a read transaction
+	//! \returns the index of the region, or -1 if the read is not in a safe region
+	int32_t mGetSafeRegion(const tas_rw_trans_st* trans) const;
+
+	//! \brief Get the cost of a read according to the cost model.
+	//! \param addr target address
+	//! \param num_bytes number of bytes to be read
+	//! \returns the cost in bytes
+	uint64_t mGetCost(uint64_t addr, uint64_t num_bytes) const;
+
+	//! \brief Plan a run of consecutive read transactions in safe regions.
+	//! \param trans pointer to the first read transaction of the run
+	//! \param run_region pointer to the safe region of each read of the run
+	//! \param num_trans number of read transactions in the run
+	void mPlanRdRun(const tas_rw_trans_st* trans, const int32_t* run_region, uint32_t num_trans);
+
+	//! \brief Widen a span to 64 bit alignment if it stays in the safe region and costs less.
+	//! \param addr pointer to the start address of the span
+	//! \param addr_end pointer to the first address after the span
+	//! \param region index of the safe region which contains the span
+	void mAlignSpan(uint64_t* addr, uint64_t* addr_end, int32_t region) const;
+
+	//! \brief Add a span read or the single read of a cluster to the planned list.
+	//! \param trans pointer to the first read transaction of the run
+	//! \param order indices of the reads of the cluster in trans
+	//! \param num number of reads in the cluster
+	//! \param addr start address of the span
+	//! \param addr_end first address after the span
+	//! \param region index of the safe region which contains the span
+	void mAddCluster(const tas_rw_trans_st* trans, const uint32_t* order, uint32_t num, uint64_t addr, uint64_t addr_end, int32_t region);
+
+	std::vector<tas_safe_region_st> mSafeRegion;	//!< \brief Regions which are safe to over-read
+
+	uint32_t mPl0Overhead = PL0_OVERHEAD_DEFAULT;	//!< \brief Cost of a PL0 transaction in bytes
+	uint32_t mMaxSpanSize = MAX_SPAN_SIZE_DEFAULT;	//!< \brief Maximum size of a span read
+
+	std::vector<tas_rw_trans_st>  mTransPlanned;	//!< \brief Planned list of transactions
+	std::vector<tas_span_st> mSpan;					//!< \brief Span reads of the planned list
+	std::vector<tas_span_copy_st> mSpanCopy;		//!< \brief Reads which are served from span reads
+	std::vector<uint64_t> mSpanData;				//!< \brief Read buffer of all span reads, each span is 8 byte aligned
+	std::vector<uint32_t> mRunOrder;				//!< \brief Sort buffer for a run of reads
+	std::vector<int32_t>  mRunRegion;				//!< \brief Safe region of each transaction, -1 if none or not a read
+
+	uint32_t mNumRdMerged = 0;	//!< \brief Number of reads which were merged in the last plan
+	uint32_t mNumBytesGap = 0;	//!< \brief Number of discarded bytes in the last plan
+	uint32_t mSpanDataSize = 0;	//!< \brief Size of the span data of the last plan in bytes
+};
+
+//! \} // end of group Packet_Handler_RW
@@ -0,0 +1,132 @@
+/*
+ *  Copyright (c) 2024 Infineon Technologies AG.
+ *
+ *  This file is part of TAS Client, an API for device access for Infineon's 
+ *  automotive MCUs. 
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *  **************************************************************************************************************** */
+// TAS includes
+#include "tas_utils_discovery.h"
+#include "tas_utils.h"
+
+// Standard includes
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+//! \brief Client which only reads the target and client lists of a server
+class CTasClientDiscovery final : public CTasClientServerCon
+{
+
+public:
+	//! \brief Discovery client constructor.
+	//! \param timeout_ms timeout in milliseconds for the connection and each response
+	explicit CTasClientDiscovery(uint32_t timeout_ms)
+		: CTasClientServerCon("TasDiscovery", &mEi)
+	{
+		mConnectTimeoutMs = (int)timeout_ms;
+		mMbIf->config(timeout_ms, TAS_MAX_PKT_SIZE_1KB);
+	}
+
+	tas_return_et device_connect(tas_clnt_dco_et dco) override
+	{
+		_unused(dco);
+		assert(false);  // No session
+		snprintf(mEi.info, TAS_INFO_STR_LEN, "ERROR: Not supported by the discovery client");
+		mEi.tas_err = TAS_ERR_FN_USAGE;
+		return mEi.tas_err;
+	}
+
+	bool device_reset_occurred() override { return false; }
+
+private:
+	tas_error_info_st mEi;	//!< \brief Contains current error information.
+};
+
+//! \brief Discover the targets and clients of a single server.
+//! \param addr server address
+//! \param timeout_ms timeout in milliseconds for the connection and each response
+//! \param server pointer to the inventory entry of the server
+static void tasutilDiscoverServer(const tasutil_server_addr_st& addr, uint32_t timeout_ms, tasutil_discovery_server_st* server)
+{
+	server->addr = addr;
+	server->targets.clear();
+	memset(&server->server_info, 0, sizeof(server->server_info));
+
+	CTasClientDiscovery client(timeout_ms);
+
+	tas_return_et ret = client.server_connect(addr.ip_addr.c_str(), addr.port_num);
+	if (ret == TAS_ERR_NONE) {
+		server->server_info = *client.get_server_info();
+
+		const tas_target_info_st* targetInfo;
+		uint32_t numTarget;
+		ret = client.get_targets(&targetInfo, &numTarget);
+		if (ret == TAS_ERR_NONE) {
+			server->targets.resize(numTarget);
+			for (uint32_t t = 0; t < numTarget; t++)
+				server->targets[t].target_info = targetInfo[t];  // Copied before the next request reuses the buffers
+		}
+	}
+
+	for (size_t t = 0; t < server->targets.size() && ret == TAS_ERR_NONE; t++) {
+		tasutil_discovery_target_st& target = server->targets[t];
+
+		const char* sessionName;
+		const tas_target_client_info_st* clientInfo;
+		uint32_t numClient;
+		ret = client.get_target_clients(target.target_info.identifier, &sessionName, &target.session_start_time_us,
+										&clientInfo, &numClient);
+		if (ret == TAS_ERR_NONE) {
+			target.session_name = sessionName;
+			target.client_info.assign(clientInfo, clientInfo + numClient);
+		}
+	}
+
+	server->tas_err = ret;
+	server->error_info = (ret == TAS_ERR_NONE) ? "" : client.get_error_info();
+}
+
+tas_return_et tasutil_discover_servers(const std::vector<tasutil_server_addr_st>& servers,
+									   std::vector<tasutil_discovery_server_st>* inventory,
+									   uint32_t timeout_ms, uint32_t max_threads)
+{
+	inventory->clear();
+	inventory->resize(servers.size());
+
+	// Each worker takes the next server which was not yet taken. The entries of the inventory are
+	// only written by the worker which took the server, so no further synchronization is needed.
+	std::atomic<size_t> next(0);
+	auto worker = [&]() {
+		for (size_t s = next++; s < servers.size(); s = next++)
+			tasutilDiscoverServer(servers[s], timeout_ms, &(*inventory)[s]);
+	};
+
+	size_t numThread = std::min<size_t>(std::max<uint32_t>(max_threads, 1), servers.size());
+	std::vector<std::thread> threads;
+	threads.reserve(numThread);
+	for (size_t t = 0; t < numThread; t++)
+		threads.emplace_back(worker);
+	for (std::thread& thread : threads)
+		thread.join();
+
+	for (const tasutil_discovery_server_st& server : *inventory) {
+		if (server.tas_err != TAS_ERR_NONE)
+			return server.tas_err;
+	}
+	return TAS_ERR_NONE;
+}
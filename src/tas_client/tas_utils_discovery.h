@@ -0,0 +1,77 @@
+/*
+ *  Copyright (c) 2024 Infineon Technologies AG.
+ *
+ *  This file is part of TAS Client, an API for device access for Infineon's 
+ *  automotive MCUs. 
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *  **************************************************************************************************************** */
+
+#pragma once
+
+//! \addtogroup TAS_utils
+//! \{
+
+// TAS includes
+#include "tas_client_server_con.h"
+
+// Standard includes
+#include <string>
+#include <vector>
+
+//! \brief Address of a TAS server
+struct tasutil_server_addr_st {
+	std::string ip_addr;	//!< \brief Hostname of a TAS server, can be an IP address or a domain based hostname
+	uint16_t    port_num = TAS_PORT_NUM_SERVER_DEFAULT;	//!< \brief Server's port number
+};
+
+//! \brief Target of a server with the clients connected to it
+struct tasutil_discovery_target_st {
+	tas_target_info_st target_info;		//!< \brief Target information as returned by get_targets()
+	std::string session_name;			//!< \brief Name of the running session
+	uint64_t    session_start_time_us;	//!< \brief Start time of the running session
+	std::vector<tas_target_client_info_st> client_info;	//!< \brief Clients connected to the target
+};
+
+//! \brief Discovery result of one server
+struct tasutil_discovery_server_st {
+	tasutil_server_addr_st addr;	//!< \brief Server address
+	tas_return_et tas_err;			//!< \brief \ref TAS_ERR_NONE if the server was completely discovered
+	std::string   error_info;		//!< \brief Error information in case of an error, otherwise empty
+	tas_server_info_st server_info;	//!< \brief Server information, only valid if the connection was established
+	std::vector<tasutil_discovery_target_st> targets;	//!< \brief Targets connected to the server
+};
+
+//! \brief Discovery limits.
+enum {
+	TASUTIL_DISCOVERY_TIMEOUT_MS_DEFAULT = 2000,	//!< \brief Default timeout for the connection and each response
+	TASUTIL_DISCOVERY_MAX_THREADS_DEFAULT = 16,		//!< \brief Default maximum number of concurrently discovered servers
+};
+
+//! \brief Build an inventory of the targets and clients of several servers.
+//! \details The servers are discovered concurrently by up to max_threads threads. Each thread connects to a server,
+//! pages through get_targets() and get_target_clients() of all targets and continues with the next server.
+//! A server which cannot be reached or does not respond is reported with its error in the inventory and does not
+//! delay the discovery of the other servers by more than the timeout. \n
+//! The connections are closed after the discovery. Sessions are not started.
+//! \param servers list of server addresses
+//! \param inventory pointer to the inventory, receives one entry per server in the order of servers
+//! \param timeout_ms timeout in milliseconds for the connection to a server and for each of its responses
+//! \param max_threads maximum number of servers which are discovered at the same time
+//! \returns \ref TAS_ERR_NONE if all servers were discovered, otherwise the error of the first failed server
+tas_return_et tasutil_discover_servers(const std::vector<tasutil_server_addr_st>& servers,
+									   std::vector<tasutil_discovery_server_st>* inventory,
+									   uint32_t timeout_ms = TASUTIL_DISCOVERY_TIMEOUT_MS_DEFAULT,
+									   uint32_t max_threads = TASUTIL_DISCOVERY_MAX_THREADS_DEFAULT);
+
+//! \} // end of group TAS_utils
@@ -23,13 +23,20 @@
 
 // Standard includes
 #include <cassert>
+#include <vector>
 
 tas_return_et tasutil_jtag_scan(CTasClientRw* tcrw, const tasutil_jtag_scan_st* scan, uint8_t num_scan)
 {
 	tas_return_et ret = TAS_ERR_NONE;
 
+	// Reused by subsequent calls of the same thread, only grows
+	thread_local std::vector<tas_rw_trans_st> rwTransBuf;
+	thread_local std::vector<uint64_t> zeroDataBlockBuf;
+
 	uint32_t numTransMax = 16 + 6 * num_scan;  // Very generous
-	auto rwTrans = new tas_rw_trans_st[numTransMax];
+	if (rwTransBuf.size() < numTransMax)
+		rwTransBuf.resize(numTransMax);
+	tas_rw_trans_st* rwTrans = rwTransBuf.data();
 	uint64_t* zeroDataBlock = nullptr;
 
 	uint32_t resDat;
@@ -52,8 +59,9 @@ tas_return_et tasutil_jtag_scan(CTasClientRw* tcrw, const tasutil_jtag_scan_st*
 		uint64_t* dataOut = scan[s].data_out;
 		const uint64_t* dataIn = scan[s].data_in;
 		if (scan[s].data_in == nullptr) {
-			if (!zeroDataBlock)
-				zeroDataBlock = new uint64_t[maxBitsTrans / 64];
+			if (zeroDataBlockBuf.empty())
+				zeroDataBlockBuf.resize(maxBitsTrans / 64, 0);
+			zeroDataBlock = zeroDataBlockBuf.data();
 			dataIn = zeroDataBlock;
 		}
 
@@ -91,9 +99,6 @@ tas_return_et tasutil_jtag_scan(CTasClientRw* tcrw, const tasutil_jtag_scan_st*
 		ret = tcrw->execute_trans(rwTrans, t);
 	}
 
-	delete[] rwTrans;
-	delete[] zeroDataBlock;
-
 	return ret;
 }
 
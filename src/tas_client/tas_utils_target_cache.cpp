@@ -0,0 +1,232 @@
+/*
+ *  Copyright (c) 2024 Infineon Technologies AG.
+ *
+ *  This file is part of TAS Client, an API for device access for Infineon's 
+ *  automotive MCUs. 
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *  **************************************************************************************************************** */
+// TAS includes
+#include "tas_utils_target_cache.h"
+#include "tas_utils.h"
+
+// Standard includes
+#include <cassert>
+#include <cstring>
+#include <algorithm>
+
+CTasTargetCache::CTasTargetCache(CTasClientServerCon* client, uint32_t ttl_ms)
+	: mClient(client), mTtlMs(ttl_ms)
+{
+	assert(mClient);
+}
+
+bool CTasTargetCache::mExpired(uint64_t time_ms) const
+{
+	return (time_ms == 0) || (tasutil_time_ms() - time_ms >= mTtlMs);
+}
+
+void CTasTargetCache::invalidate()
+{
+	mTargetInfoTimeMs = 0;
+	for (tas_cached_clients_st& clients : mClients)
+		clients.time_ms = 0;
+}
+
+CTasTargetCache::tas_cached_clients_st* CTasTargetCache::mFindClients(std::vector<tas_cached_clients_st>& list, const char* identifier)
+{
+	auto it = std::find_if(list.begin(), list.end(),
+		[identifier](const tas_cached_clients_st& clients) { return clients.identifier == identifier; });
+	return (it != list.end()) ? &(*it) : nullptr;
+}
+
+tas_return_et CTasTargetCache::mRefreshTargets()
+{
+	if (!mExpired(mTargetInfoTimeMs))
+		return TAS_ERR_NONE;
+
+	const tas_target_info_st* targetInfo;
+	uint32_t numTarget;
+	mNumServerRq++;
+	if (tas_return_et ret = mClient->get_targets(&targetInfo, &numTarget); ret != TAS_ERR_NONE)
+		return ret;
+
+	mTargetInfo.assign(targetInfo, targetInfo + numTarget);
+	mTargetInfoTimeMs = tasutil_time_ms();
+
+	// Drop the client lists of disconnected targets
+	mClients.erase(std::remove_if(mClients.begin(), mClients.end(), [this](const tas_cached_clients_st& clients) {
+		return std::none_of(mTargetInfo.begin(), mTargetInfo.end(),
+			[&clients](const tas_target_info_st& ti) { return clients.identifier == ti.identifier; });
+	}), mClients.end());
+
+	return TAS_ERR_NONE;
+}
+
+tas_return_et CTasTargetCache::mRefreshClients(const char* identifier, tas_cached_clients_st** clients)
+{
+	tas_cached_clients_st* cached = mFindClients(mClients, identifier);
+
+	bool refresh = (cached == nullptr) || mExpired(cached->time_ms);
+	if (!refresh) {
+		auto ti = std::find_if(mTargetInfo.begin(), mTargetInfo.end(),
+			[identifier](const tas_target_info_st& ti) { return strcmp(ti.identifier, identifier) == 0; });
+		refresh = (ti != mTargetInfo.end()) && (ti->num_client != (uint32_t)cached->client_info.size());
+	}
+
+	if (refresh) {
+		const char* sessionName;
+		uint64_t sessionStartTimeUs;
+		const tas_target_client_info_st* clientInfo;
+		uint32_t numClient;
+		mNumServerRq++;
+		tas_return_et ret = mClient->get_target_clients(identifier, &sessionName, &sessionStartTimeUs, &clientInfo, &numClient);
+		if (ret != TAS_ERR_NONE)
+			return ret;
+
+		if (cached == nullptr) {
+			mClients.emplace_back();
+			cached = &mClients.back();
+			cached->identifier = identifier;
+		}
+		cached->session_name = sessionName;
+		cached->session_start_time_us = sessionStartTimeUs;
+		cached->client_info.assign(clientInfo, clientInfo + numClient);
+		cached->time_ms = tasutil_time_ms();
+	}
+
+	*clients = cached;
+	return TAS_ERR_NONE;
+}
+
+tas_return_et CTasTargetCache::get_targets(const tas_target_info_st** target_info, uint32_t* num_target)
+{
+	*target_info = nullptr;
+	*num_target = 0;
+
+	if (tas_return_et ret = mRefreshTargets(); ret != TAS_ERR_NONE)
+		return ret;
+
+	*target_info = mTargetInfo.data();
+	*num_target = (uint32_t)mTargetInfo.size();
+	return TAS_ERR_NONE;
+}
+
+tas_return_et CTasTargetCache::get_target_clients(const char* identifier, const char** session_name,
+												  uint64_t* session_start_time_us,
+												  const tas_target_client_info_st** target_client_info,
+												  uint32_t* num_client)
+{
+	*session_name = "";
+	*session_start_time_us = 0;
+	*target_client_info = nullptr;
+	*num_client = 0;
+
+	tas_cached_clients_st* clients;
+	if (tas_return_et ret = mRefreshClients(identifier, &clients); ret != TAS_ERR_NONE)
+		return ret;
+
+	*session_name = clients->session_name.c_str();
+	*session_start_time_us = clients->session_start_time_us;
+	*target_client_info = clients->client_info.data();
+	*num_client = (uint32_t)clients->client_info.size();
+	return TAS_ERR_NONE;
+}
+
+tas_return_et CTasTargetCache::get_changes(std::vector<tasutil_target_change_st>* changes)
+{
+	changes->clear();
+
+	if (tas_return_et ret = mRefreshTargets(); ret != TAS_ERR_NONE)
+		return ret;
+
+	for (const tas_target_info_st& ti : mTargetInfo) {
+		tas_cached_clients_st* clients;
+		if (tas_return_et ret = mRefreshClients(ti.identifier, &clients); ret != TAS_ERR_NONE)
+			return ret;
+	}
+
+	tasutil_target_change_st change = {};
+
+	for (const tas_target_info_st& prevTi : mReportedTargetInfo) {
+		auto ti = std::find_if(mTargetInfo.begin(), mTargetInfo.end(),
+			[&prevTi](const tas_target_info_st& ti) { return strcmp(ti.identifier, prevTi.identifier) == 0; });
+		if (ti == mTargetInfo.end()) {
+			mAddClientChanges(prevTi, mFindClients(mReportedClients, prevTi.identifier), nullptr, changes);
+			change.ttc = TTC_TARGET_REMOVED;
+			change.target_info = prevTi;
+			changes->push_back(change);
+		}
+	}
+
+	for (const tas_target_info_st& ti : mTargetInfo) {
+		auto prevTi = std::find_if(mReportedTargetInfo.begin(), mReportedTargetInfo.end(),
+			[&ti](const tas_target_info_st& prevTi) { return strcmp(ti.identifier, prevTi.identifier) == 0; });
+		bool added = (prevTi == mReportedTargetInfo.end());
+		bool changed = !added && ((ti.device_type != prevTi->device_type) || (ti.dev_con_phys != prevTi->dev_con_phys)
+								  || (memcmp(ti.device_id, prevTi->device_id, sizeof(ti.device_id)) != 0));
+		if (added || changed) {
+			change.ttc = (added) ? TTC_TARGET_ADDED : TTC_TARGET_CHANGED;
+			change.target_info = ti;
+			changes->push_back(change);
+		}
+		mAddClientChanges(ti, mFindClients(mReportedClients, ti.identifier), mFindClients(mClients, ti.identifier), changes);
+	}
+
+	mReportedTargetInfo = mTargetInfo;
+	mReportedClients = mClients;
+
+	return TAS_ERR_NONE;
+}
+
+void CTasTargetCache::mAddClientChanges(const tas_target_info_st& target_info, const tas_cached_clients_st* prev,
+										const tas_cached_clients_st* curr, std::vector<tasutil_target_change_st>* changes) const
+{
+	static const std::vector<tas_target_client_info_st> noClient;
+	const std::vector<tas_target_client_info_st>& prevCi = (prev) ? prev->client_info : noClient;
+	const std::vector<tas_target_client_info_st>& currCi = (curr) ? curr->client_info : noClient;
+
+	auto sameClient = [](const tas_target_client_info_st& a, const tas_target_client_info_st& b) {
+		return (a.client_pid == b.client_pid) && (a.client_connect_time == b.client_connect_time);
+	};
+
+	tasutil_target_change_st change = {};
+	change.target_info = target_info;
+
+	for (const tas_target_client_info_st& ci : prevCi) {
+		if (std::none_of(currCi.begin(), currCi.end(), [&](const tas_target_client_info_st& c) { return sameClient(c, ci); })) {
+			change.ttc = TTC_CLIENT_DISCONNECTED;
+			change.client_info = ci;
+			changes->push_back(change);
+		}
+	}
+
+	for (const tas_target_client_info_st& ci : currCi) {
+		auto p = std::find_if(prevCi.begin(), prevCi.end(), [&](const tas_target_client_info_st& c) { return sameClient(c, ci); });
+		if (p == prevCi.end()) {
+			change.ttc = TTC_CLIENT_CONNECTED;
+			change.num_byte_c2s_delta = 0;
+			change.num_byte_s2c_delta = 0;
+		}
+		else if ((ci.num_byte_c2s != p->num_byte_c2s) || (ci.num_byte_s2c != p->num_byte_s2c)) {
+			change.ttc = TTC_CLIENT_TRAFFIC;
+			change.num_byte_c2s_delta = ci.num_byte_c2s - p->num_byte_c2s;
+			change.num_byte_s2c_delta = ci.num_byte_s2c - p->num_byte_s2c;
+		}
+		else {
+			continue;
+		}
+		change.client_info = ci;
+		changes->push_back(change);
+	}
+}
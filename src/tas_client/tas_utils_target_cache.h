@@ -0,0 +1,170 @@
+/*
+ *  Copyright (c) 2024 Infineon Technologies AG.
+ *
+ *  This file is part of TAS Client, an API for device access for Infineon's 
+ *  automotive MCUs. 
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *  **************************************************************************************************************** */
+
+#pragma once
+
+//! \addtogroup TAS_utils
+//! \{
+
+// TAS includes
+#include "tas_client_server_con.h"
+
+// Standard includes
+#include <string>
+#include <vector>
+
+//! \brief Type of a change reported by \ref CTasTargetCache::get_changes()
+enum tasutil_target_change_et : uint8_t {
+	TTC_TARGET_ADDED = 1,			//!< \brief Target connected to the server
+	TTC_TARGET_REMOVED,				//!< \brief Target disconnected from the server
+	TTC_TARGET_CHANGED,				//!< \brief Device type, device ID or physical connection of a target changed
+	TTC_CLIENT_CONNECTED,			//!< \brief Client connected to a target
+	TTC_CLIENT_DISCONNECTED,		//!< \brief Client disconnected from a target
+	TTC_CLIENT_TRAFFIC,				//!< \brief Bytes were transferred between a client and the server
+};
+
+//! \brief Change of the targets of a server or of the clients of a target
+struct tasutil_target_change_st {
+	tasutil_target_change_et ttc;			//!< \brief Type of the change
+	tas_target_info_st target_info;			//!< \brief Current target information, last known for TTC_TARGET_REMOVED
+	tas_target_client_info_st client_info;	//!< \brief Client information, only valid for client changes
+	uint64_t num_byte_c2s_delta;			//!< \brief Bytes sent by the client since the last report, only for TTC_CLIENT_TRAFFIC
+	uint64_t num_byte_s2c_delta;			//!< \brief Bytes received by the client since the last report, only for TTC_CLIENT_TRAFFIC
+};
+
+//! \brief Cache for the target and client lists of a server
+//! \details Monitoring tools which poll the lists every few seconds cause a full paging of the lists in the server
+//! for each call. The cache serves the lists from its copy until the time to live (TTL) expires. \n
+//! \ref get_changes() reports the differences to the previous call instead of the full lists. A client list is only
+//! requested again if its TTL expired or if num_client of its target changed. Clients are identified by
+//! client_pid and client_connect_time. The traffic counters num_byte_c2s and num_byte_s2c are only updated with
+//! the client list, so the TTL also defines the resolution of TTC_CLIENT_TRAFFIC.
+class CTasTargetCache
+{
+
+public:
+	CTasTargetCache(const CTasTargetCache&) = delete; //!< \brief delete the copy constructor
+	CTasTargetCache operator= (const CTasTargetCache&) = delete; //!< \brief delete copy-assignment operator
+
+	//! \brief Target cache constructor.
+	//! \param client pointer to a client which is connected to a server. Must outlive the cache.
+	//! \param ttl_ms time to live of the cached lists in milliseconds, default: \ref TTL_MS_DEFAULT
+	explicit CTasTargetCache(CTasClientServerCon* client, uint32_t ttl_ms = TTL_MS_DEFAULT);
+
+	//! \brief Get a list of targets connected to the server, see \ref CTasClientServerCon::get_targets()
+	//! \details The list is only requested from the server if the cached one is older than the TTL.
+	//! \param target_info pointer to a list of targets, valid until the next call of the cache
+	//! \param num_target pointer to a number of targets in the list
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et get_targets(const tas_target_info_st** target_info, uint32_t* num_target);
+
+	//! \brief Get a list of clients connected to a target, see \ref CTasClientServerCon::get_target_clients()
+	//! \details The list is only requested from the server if the cached one is older than the TTL or if num_client
+	//! of the target in the cached target list differs from the cached client list.
+	//! \param identifier Pointer to a c-string containing target's identifier
+	//! \param session_name Pointer to a session name of a running session, valid until the next call of the cache
+	//! \param session_start_time_us Pointer to a start time of the running session
+	//! \param target_client_info Pointer to a list of clients, valid until the next call of the cache
+	//! \param num_client Pointer to a number of clients in the list
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et get_target_clients(const char* identifier, const char** session_name,
+									 uint64_t* session_start_time_us,
+									 const tas_target_client_info_st** target_client_info,
+									 uint32_t* num_client);
+
+	//! \brief Get the changes of the targets and their clients since the last call.
+	//! \details The first call reports all targets and clients as added or connected.
+	//! Expired lists are refreshed before the comparison. Without expired lists no request is sent to the server.
+	//! \param changes pointer to a list which receives the changes
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et get_changes(std::vector<tasutil_target_change_st>* changes);
+
+	//! \brief Invalidate the cached lists. The next call requests them from the server.
+	void invalidate();
+
+	//! \brief Set the time to live of the cached lists.
+	//! \param ttl_ms time to live in milliseconds, 0 disables the cache
+	void set_ttl(uint32_t ttl_ms) { mTtlMs = ttl_ms; }
+
+	//! \brief Get the number of list requests which were sent to the server.
+	//! \returns the number of get_targets() and get_target_clients() calls of the client
+	uint32_t get_num_server_rq() const { return mNumServerRq; }
+
+	//! \brief Get current error information string
+	//! \returns pointer to a c-string containing current error information.
+	const char* get_error_info() const { return mClient->get_error_info(); }
+
+	//! \brief Cache defaults.
+	enum {
+		TTL_MS_DEFAULT = 5000,	//!< \brief Default time to live of the cached lists
+	};
+
+private:
+
+	//! \brief Cached client list of a target
+	typedef struct {
+		std::string identifier;			//!< \brief Target identifier
+		std::string session_name;		//!< \brief Name of the running session
+		uint64_t session_start_time_us;	//!< \brief Start time of the running session
+		std::vector<tas_target_client_info_st> client_info;	//!< \brief Clients connected to the target
+		uint64_t time_ms;				//!< \brief Time of the request, 0 if invalid
+	} tas_cached_clients_st;
+
+	//! \brief Check if a list requested at a given time has expired.
+	//! \param time_ms time of the request, 0 if invalid
+	//! \returns \c true if the list needs to be requested again
+	bool mExpired(uint64_t time_ms) const;
+
+	//! \brief Request the target list if it has expired.
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et mRefreshTargets();
+
+	//! \brief Request the client list of a target if it has expired or num_client of the target changed.
+	//! \param identifier target identifier
+	//! \param clients pointer which receives the cached client list
+	//! \returns \ref TAS_ERR_NONE on success, otherwise any other relevant TAS error code
+	tas_return_et mRefreshClients(const char* identifier, tas_cached_clients_st** clients);
+
+	//! \brief Report the client changes of a target.
+	//! \param target_info current target information
+	//! \param prev client list of the last report, nullptr if the target was not reported
+	//! \param curr current client list, nullptr if the target was removed
+	//! \param changes pointer to the list of changes
+	void mAddClientChanges(const tas_target_info_st& target_info, const tas_cached_clients_st* prev,
+						   const tas_cached_clients_st* curr, std::vector<tasutil_target_change_st>* changes) const;
+
+	//! \brief Find the cached client list of a target.
+	//! \param list list to be searched
+	//! \param identifier target identifier
+	//! \returns pointer to the client list, nullptr if not found
+	static tas_cached_clients_st* mFindClients(std::vector<tas_cached_clients_st>& list, const char* identifier);
+
+	CTasClientServerCon* mClient;	//!< \brief Client which is connected to the server
+	uint32_t mTtlMs;				//!< \brief Time to live of the cached lists
+	uint32_t mNumServerRq = 0;		//!< \brief Number of list requests sent to the server
+
+	std::vector<tas_target_info_st> mTargetInfo;	//!< \brief Cached target list
+	uint64_t mTargetInfoTimeMs = 0;					//!< \brief Time of the target list request, 0 if invalid
+	std::vector<tas_cached_clients_st> mClients;	//!< \brief Cached client lists
+
+	std::vector<tas_target_info_st> mReportedTargetInfo;	//!< \brief Target list of the last get_changes() call
+	std::vector<tas_cached_clients_st> mReportedClients;	//!< \brief Client lists of the last get_changes() call
+};
+
+//! \} // end of group TAS_utils
@@ -154,6 +154,20 @@ int CTasConnSocket::recv(void* buf, int len, int timeout_ms)
 	return ret;
 }
 
+bool CTasConnSocket::check_idle()
+{
+	int sockDesc = get_socket_desc();
+	if (sockDesc < 0)
+		return false;
+
+	fd_set setR;
+	FD_ZERO(&setR);
+	FD_SET(sockDesc, &setR);
+
+	struct timeval timeout = { 0, 0 };  // Poll
+	return (::select(sockDesc + 1, &setR, nullptr, nullptr, &timeout) == 0);
+}
+
 int CTasConnSocket::recvAll(void* buf, int len, int timeout_ms)
 {
 	int totalRecvd = 0;
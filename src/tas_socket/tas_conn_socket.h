@@ -80,6 +80,12 @@ public:
 	//! received, \c -1 in case of an error, \c 0 if the connection has been gracefully closed
 	int recvAll(void* buf, int len, int timeout_ms = -1);
 
+	//! \brief Check without blocking if an idle connection is still established
+	//! \details No data is expected on an idle connection. A readable socket means that the remote closed the
+	//! connection, an error occurred or unexpected data arrived.
+	//! \returns \c true if nothing is pending on the connection, otherwise \c false
+	bool check_idle();
+
 	//! \brief Retrieves remote's IP address
 	//! \returns remote's IP address as c-string in dot notation
 	const char* get_remote_ip();